@@ -0,0 +1,22 @@
+/// @file Boot.cpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Early boot hook called by the reset handler before the RAM is initialized.
+/// @details Neither .data nor .bss are valid yet, so the hook only writes to peripheral registers.
+
+#include <Dwt.hpp>
+#include <Rcc.hpp>
+
+// NOLINTBEGIN
+extern "C" void BootStart()
+{
+  // The boot milestones count from here
+  Peripherals::Dwt::CycleCounter::Restart();
+
+#if defined(FAST_BOOT)
+  // The crystal settles while the RAM is initialized and the first tasks are constructed
+  Peripherals::Rcc::ResetAndClockControl::StartOscillators();
+#endif
+}
+// NOLINTEND
@@ -6,37 +6,208 @@
 
 #include <stm32f1xx.h>
 
+#include <BootProfiler.hpp>
+#include <Coroutine.hpp>
 #include <Display.hpp>
+#include <Events.hpp>
+#include <Inputs.hpp>
 #include <InterruptManager.hpp>
+#include <Kernel.hpp>
 #include <Leds.hpp>
+#include <PowerManager.hpp>
 #include <Print.hpp>
 #include <Rcc.hpp>
+#include <TaskProfiler.hpp>
+#include <TimerService.hpp>
+#include <cstdlib>
 
 using RccType = Peripherals::Rcc::ResetAndClockControl;
 using InterruptManagerType = Peripherals::InterruptManager;
+using LedsType = Tasks::Leds::LedsTask;
+using DisplayType = Tasks::Display::DisplayTask;
+using InputsType = Tasks::Inputs::InputsTask;
+using ExecutorType = Scheduler::CoroutineExecutor<Peripherals::Rcc::SysTickSource, 1>;
+
+namespace
+{
+#if defined(FAST_BOOT)
+  /// @brief Switch the LEDs on before the clocks are configured, the crystal was started by the reset handler.
+  constexpr bool FastBoot = true;
+#else
+  /// @brief Configure the clocks before anything else.
+  constexpr bool FastBoot = false;
+#endif
+
+  /// @brief Priority of the thread reacting to the interrupt events.
+  constexpr std::size_t EventThreadPriority = 0;
+
+  /// @brief Priority of the thread running the coroutine tasks, it is the idle thread of the kernel.
+  constexpr std::size_t BackgroundThreadPriority = 1;
+
+  /// @brief Stack size of the event thread in bytes, printf needs most of it.
+  constexpr std::size_t EventThreadStackSize = 1536;
+
+  /// @brief Stack size of the background thread in bytes, the coroutine frames are kept in their own arena.
+  constexpr std::size_t BackgroundThreadStackSize = 1024;
+
+  /// @brief Cycles the print task may take to react to the events.
+  constexpr uint32_t PrintBudget = 10 * RccType::Ticks;
+
+  /// @brief Cycles a resumption of the LEDs refresh may take, the budget of the LEDs task.
+  constexpr uint32_t LedsBudget = LedsType::Budget * (RccType::Ticks / 1000);
+
+  /// @brief Cycles a resumption of the display refresh may take, the budget of the display task.
+  constexpr uint32_t DisplayBudget = DisplayType::Budget * (RccType::Ticks / 1000);
+
+  /// @brief Ticks the background thread sleeps at most, when neither a task nor a timer is due.
+  constexpr uint32_t MaxIdleTicks = 1000;
+
+  // The stacks are part of .bss, the linker script fails the link if .data, .bss, _Min_Heap_Size and _Min_Stack_Size
+  // of the main stack exceed the RAM
+  // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+  constinit Kernel::ThreadStack<EventThreadStackSize> eventThreadStack {};
+  constinit Kernel::ThreadStack<BackgroundThreadStackSize> backgroundThreadStack {};
+  // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Work of the background thread.
+  struct BackgroundWork
+  {
+    /// @brief Executor of the LEDs refresh.
+    ExecutorType& ledsExecutor;
+
+    /// @brief Executor of the display refresh.
+    ExecutorType& displayExecutor;
+  };
+
+  /// @brief Reacts to the events posted by the interrupt handlers.
+  /// @param context Print task.
+  void RunEventThread(void* context)
+  {
+    auto& printTask = *static_cast<Tasks::Print::PrintTask*>(context);
+
+    for (;;)
+    {
+      Events::interruptSignal.Wait();
+
+      const auto start = Profiling::Begin();
+      printTask.Run();
+      Profiling::End<Profiling::TaskId::Print, PrintBudget>(start);
+    }
+  }
+
+  /// @brief Returns whether the background thread has work pending, checked with interrupts masked before it sleeps.
+  /// @details An interrupt may set an event or defer a timer callback after the executors were polled, sleeping then
+  ///          would delay the work until the next unrelated wakeup.
+  /// @param context Background work.
+  /// @return True if a coroutine task is ready or a timer callback is deferred.
+  bool HasPendingWork(void* context)
+  {
+    const auto& work = *static_cast<const BackgroundWork*>(context);
+
+    return work.ledsExecutor.HasReadyTask() || work.displayExecutor.HasReadyTask() ||
+           Timers::timerService.HasDeferred();
+  }
+
+  /// @brief Runs the coroutine tasks and the deferred timer callbacks and sleeps until the next one is due.
+  /// @details The power manager chooses how deep to sleep from the time until the next one.
+  /// @param context Background work.
+  void RunBackgroundThread(void* context)
+  {
+    auto& work = *static_cast<BackgroundWork*>(context);
+    Profiling::bootProfiler.Record(Profiling::BootMilestone::FirstDispatch);
+
+    for (;;)
+    {
+      Timers::timerService.RunDeferred();
+
+      // Only resumptions are measured, polling without a due task would distort the minimum
+      auto start = Profiling::Begin();
+
+      if (work.ledsExecutor.Poll() != 0)
+      {
+        Profiling::End<Profiling::TaskId::Leds, LedsBudget>(start);
+      }
+
+      start = Profiling::Begin();
+
+      if (work.displayExecutor.Poll() != 0)
+      {
+        Profiling::End<Profiling::TaskId::Display, DisplayBudget>(start);
+      }
+
+      // All other threads are blocked while this one runs, so their earliest wakeup bounds the sleep as well
+      auto nextRelease = work.ledsExecutor.GetNextWakeup(Peripherals::Rcc::SysTickSource::Now() + MaxIdleTicks);
+      nextRelease = work.displayExecutor.GetNextWakeup(nextRelease);
+      nextRelease = Timers::timerService.GetNextExpiry(nextRelease);
+      Power::PowerManager::GetInstance().Idle(Kernel::kernel.GetNextWakeup(nextRelease), HasPendingWork, &work);
+    }
+  }
+}  // namespace
 
 int main()
 {
+  Profiling::bootProfiler.Record(Profiling::BootMilestone::MainEntered);
+
+  // The vectors are fetched from RAM from here on, before any interrupt is enabled
+  InterruptManagerType::RelocateVectorTable();
   InterruptManagerType::SetupNvicPriorities();
+  Profiling::Initialize();
 
-  // Get instance to configure RCC
-  RccType::GetInstance();
+  auto& rcc = RccType::GetInstance();
 
-  auto printTask = Tasks::Print::PrintTask();
-  auto ledsTask = Tasks::Leds::LedsTask();
-  auto displayTask = Tasks::Display::DisplayTask();
+  // The clocks come first, the drivers configured by the tasks derive their dividers from them
+  if constexpr (!FastBoot)
+  {
+    rcc.Init();
+    Profiling::bootProfiler.Record(Profiling::BootMilestone::ClocksReady);
+  }
 
-  /* Loop forever */
-  for (;;)
+  // The GPIO and RTC tasks do not depend on the system clock, the LEDs light up while the crystal is still settling
+  auto ledsTask = LedsType();
+  Profiling::bootProfiler.Record(Profiling::BootMilestone::FirstOutput);
+  auto displayTask = DisplayType();
+
+  if constexpr (FastBoot)
   {
-    constexpr auto delay = 1000;
+    rcc.Init();
+    Profiling::bootProfiler.Record(Profiling::BootMilestone::ClocksReady);
+  }
+
+  auto printTask = Tasks::Print::PrintTask();
+
+  // All input pins are configured and subscribed, their levels are the initial debounced states
+  auto inputsTask = InputsType();
 
-    RccType::GetInstance().Delay(delay);
+  // The LEDs refresh waits for a debounced edge of a switch, the display refresh for the RTC to signal the next minute
+  // A root task whose frame could not be allocated would never run, the arena is sized for them at compile time
+  auto ledsExecutor = ExecutorType();
+  auto displayExecutor = ExecutorType();
 
-    printTask.Run();
-    ledsTask.Run();
-    displayTask.Run();
+  if (!ledsExecutor.Spawn(ledsTask.Refresh()) || !displayExecutor.Spawn(displayTask.Refresh()))
+  {
+    std::abort();
   }
 
+  auto backgroundWork = BackgroundWork {
+    .ledsExecutor = ledsExecutor,
+    .displayExecutor = displayExecutor,
+  };
+
+  // The clock listeners of the tasks are registered, so the power manager may resume the clock profile retained across
+  // Standby. Standby loses the RAM and with it the threads and their deadlines, so this application inhibits it.
+  auto& powerManager = Power::PowerManager::GetInstance();
+  powerManager.Init();
+  powerManager.Inhibit(Power::PowerState::Standby);
+
+  Profiling::bootProfiler.Record(Profiling::BootMilestone::TasksReady);
+
+  // The event thread preempts the display refresh as soon as an interrupt posts an event
+  Kernel::kernel.CreateThread(EventThreadPriority, RunEventThread, &printTask, eventThreadStack.words);
+  Kernel::kernel.CreateThread(
+    BackgroundThreadPriority, RunBackgroundThread, &backgroundWork, backgroundThreadStack.words);
+
+  // The tasks live in the frame of main, which is kept on the main stack while the threads run
+  Kernel::kernel.Start();
+
   return 0;
 }
@@ -0,0 +1,68 @@
+/// @file Events.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Events posted by interrupt handlers to the main loop.
+/// @details Interrupt handlers only record what happened and return. The work is done by the tasks draining the
+///          queue, so no interrupt blocks on slow operations like a USART transmission.
+
+#ifndef EVENTS_EVENTS_HPP
+#define EVENTS_EVENTS_HPP
+
+#include <CriticalSection.hpp>
+#include <Kernel.hpp>
+#include <SpscQueue.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace Events
+{
+  /// @brief Type of an event.
+  enum class EventType : uint8_t
+  {
+    /// @brief A character was received, the data holds the character.
+    CharacterReceived = 1,
+  };
+
+  /// @brief Event posted by an interrupt handler.
+  struct Event
+  {
+    /// @brief Type of the event.
+    EventType type;
+
+    /// @brief Source of the event, e.g. the EXTI line.
+    uint8_t source;
+
+    /// @brief Event specific data.
+    uint16_t data;
+  };
+
+  /// @brief Capacity of the interrupt event queue.
+  constexpr std::size_t EventQueueCapacity = 16;
+
+  /// @brief Queue type for events from interrupt handlers to the main loop.
+  using EventQueue = SpscQueue<Event, EventQueueCapacity>;
+
+  /// @brief Queue for events from interrupt handlers to the main loop.
+  /// @details Constant initialized, so it is usable before any constructor ran and without a guard variable.
+  inline constinit EventQueue interruptEvents {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Signal set whenever an event is posted, so the consuming thread does not have to poll the queue.
+  inline constinit Kernel::Signal interruptSignal {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Posts an event from an interrupt handler and wakes the consuming thread.
+  /// @param event Event to post.
+  /// @details The queue has a single producer, but several interrupt handlers post. Each of them wakes the kernel, so
+  ///          none is above the kernel priority and masking it serializes the producers.
+  inline void Post(const Event& event)
+  {
+    {
+      const Peripherals::KernelLock lock;
+      interruptEvents.Push(event);
+    }
+
+    interruptSignal.Set();
+  }
+}  // namespace Events
+
+#endif  // EVENTS_EVENTS_HPP
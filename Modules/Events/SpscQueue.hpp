@@ -0,0 +1,116 @@
+/// @file SpscQueue.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Wait-free single producer single consumer queue.
+/// @details The queue is used to hand over data from an interrupt handler to the main loop. The producer only writes
+///          the tail index and the consumer only writes the head index. Both are single word atomics, which are plain
+///          loads and stores with memory barriers on the Cortex-M3, so neither side ever waits for the other.
+
+#ifndef EVENTS_SPSCQUEUE_HPP
+#define EVENTS_SPSCQUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Events
+{
+  /// @brief Fixed capacity wait-free single producer single consumer queue.
+  /// @tparam T Type of the elements.
+  /// @tparam Capacity Maximum number of elements, has to be a power of two.
+  template<class T, std::size_t Capacity>
+  class SpscQueue
+  {
+   private:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "The capacity has to be a power of two");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "The indices have to be lock free");
+
+    /// @brief Mask to map the free running indices to the buffer.
+    static constexpr uint32_t IndexMask = Capacity - 1;
+
+    /// @brief Element storage.
+    std::array<T, Capacity> buffer {};
+
+    /// @brief Free running index of the next element to read, written by the consumer only.
+    std::atomic<uint32_t> head {0};
+
+    /// @brief Free running index of the next element to write, written by the producer only.
+    std::atomic<uint32_t> tail {0};
+
+    /// @brief Number of elements which were dropped because the queue was full, written by the producer only.
+    std::atomic<uint32_t> dropped {0};
+
+   public:
+    /// @brief Constructor for the SpscQueue class.
+    constexpr SpscQueue() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+    ~SpscQueue() = default;
+
+    /// @brief Appends an element, may only be called by the producer.
+    /// @param element Element to append.
+    /// @return True if the element was appended, false if the queue was full.
+    bool Push(const T& element)
+    {
+      const auto currentTail = tail.load(std::memory_order_relaxed);
+
+      if ((currentTail - head.load(std::memory_order_acquire)) >= Capacity)
+      {
+        dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+      }
+
+      buffer[currentTail & IndexMask] = element;
+      tail.store(currentTail + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    /// @brief Removes the oldest element, may only be called by the consumer.
+    /// @return The oldest element or nothing if the queue is empty.
+    std::optional<T> Pop()
+    {
+      const auto currentHead = head.load(std::memory_order_relaxed);
+
+      if (currentHead == tail.load(std::memory_order_acquire))
+      {
+        return std::nullopt;
+      }
+
+      const auto element = buffer[currentHead & IndexMask];
+      head.store(currentHead + 1, std::memory_order_release);
+
+      return element;
+    }
+
+    /// @brief Returns the number of elements in the queue.
+    /// @return Number of elements, may be outdated as soon as it is returned.
+    std::size_t Size() const
+    {
+      return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    /// @brief Returns whether the queue is empty.
+    /// @return True if the queue is empty.
+    bool Empty() const
+    {
+      return Size() == 0;
+    }
+
+    /// @brief Returns the number of elements dropped because the queue was full.
+    /// @return Number of dropped elements.
+    uint32_t GetDropped() const
+    {
+      return dropped.load(std::memory_order_relaxed);
+    }
+  };
+}  // namespace Events
+
+#endif  // EVENTS_SPSCQUEUE_HPP
@@ -0,0 +1,237 @@
+/// @file Debouncer.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Debounces all pins of the GPIO ports in parallel with vertical counters.
+/// @details A mechanical contact bounces for a few milliseconds, so a single sample or an edge interrupt reports
+///          several presses. Each pin gets a two bit counter of the samples differing from its debounced state, the
+///          counter bits of all 16 pins of a port are kept in two words. Updating a port thus takes a handful of
+///          bitwise operations independent of the number of pins, and a pin changes its state only after it read
+///          the same level for `StableSamples` samples in a row.
+
+#ifndef INPUT_DEBOUNCER_HPP
+#define INPUT_DEBOUNCER_HPP
+
+#include <stm32f1xx.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Input
+{
+  /// @brief Debounced state of 16 inputs with a two bit vertical counter per input.
+  class VerticalCounter
+  {
+   private:
+    /// @brief Debounced states of the inputs.
+    uint16_t state = 0;
+
+    /// @brief Low bits of the counters.
+    uint16_t count0 = 0;
+
+    /// @brief High bits of the counters.
+    uint16_t count1 = 0;
+
+   public:
+    /// @brief Number of equal samples in a row after which an input changes its state.
+    static constexpr uint32_t StableSamples = 4;
+
+    /// @brief Constructor for the VerticalCounter class.
+    constexpr VerticalCounter() = default;
+
+    /// @brief Takes a sample as debounced state, e.g. at startup so the initial levels are no edges.
+    /// @param sample Levels of the inputs.
+    constexpr void Reset(const uint16_t sample)
+    {
+      state = sample;
+      count0 = 0;
+      count1 = 0;
+    }
+
+    /// @brief Counts a sample.
+    /// @param sample Levels of the inputs.
+    /// @return Mask of the inputs which changed their debounced state.
+    /// @details The counters of the inputs reading their debounced state are cleared, the others are incremented.
+    ///          A counter wrapping around to zero toggles its input.
+    constexpr uint16_t Update(const uint16_t sample)
+    {
+      const auto delta = static_cast<uint16_t>(sample ^ state);
+      count1 = static_cast<uint16_t>((count1 ^ count0) & delta);
+      count0 = static_cast<uint16_t>(~count0 & delta);
+
+      const auto toggled = static_cast<uint16_t>(delta & ~(count0 | count1));
+      state ^= toggled;
+
+      return toggled;
+    }
+
+    /// @brief Returns the debounced states.
+    /// @return Debounced states of the inputs.
+    constexpr uint16_t GetState() const
+    {
+      return state;
+    }
+
+    /// @brief Returns whether all inputs read their debounced state at the last sample.
+    /// @return True if no counter runs, so further samples cannot change a state until an input changes its level.
+    constexpr bool IsSettled() const
+    {
+      return (count0 | count1) == 0;
+    }
+  };
+
+  /// @brief Debounces all pins of several GPIO ports and collects their edges.
+  /// @tparam PortBases Base addresses of the GPIO ports (e.g., GPIOA_BASE).
+  /// @details A pin is pressed on its rising edge and released on its falling edge, for active low inputs the two
+  ///          are swapped. The edges are collected until a task takes them, the sampling task and the consumers may
+  ///          preempt each other.
+  template<uintptr_t... PortBases>
+  class Debouncer
+  {
+   private:
+    /// @brief Base addresses of the ports, in the order of the template parameters.
+    static constexpr std::array<uintptr_t, sizeof...(PortBases)> Ports = {PortBases...};
+
+    static_assert(sizeof...(PortBases) > 0, "The debouncer needs at least one port");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "The edge masks have to be lock free");
+
+    /// @brief Counters of the ports.
+    std::array<VerticalCounter, sizeof...(PortBases)> counters {};
+
+    /// @brief Rising edges per port not taken yet.
+    std::array<std::atomic<uint32_t>, sizeof...(PortBases)> pressed {};
+
+    /// @brief Falling edges per port not taken yet.
+    std::array<std::atomic<uint32_t>, sizeof...(PortBases)> released {};
+
+   public:
+    /// @brief Number of debounced ports.
+    static constexpr std::size_t PortCount = sizeof...(PortBases);
+
+    /// @brief Returns the index of a port.
+    /// @param portBase Base address of the port.
+    /// @return Index of the port in the template parameters, `PortCount` if it is not debounced.
+    static constexpr std::size_t IndexOf(const uintptr_t portBase)
+    {
+      std::size_t index = 0;
+
+      while (index < PortCount && Ports[index] != portBase)
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    /// @brief Reads the input data register of a port.
+    /// @param index Index of the port.
+    /// @return Levels of the pins.
+    static uint16_t Read(const std::size_t index)
+    {
+      return static_cast<uint16_t>(reinterpret_cast<GPIO_TypeDef*>(Ports[index])->IDR);
+    }
+
+    /// @brief Constructor for the Debouncer class.
+    constexpr Debouncer() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    Debouncer(const Debouncer&) = delete;
+    Debouncer& operator=(const Debouncer&) = delete;
+    Debouncer(Debouncer&&) = delete;
+    Debouncer& operator=(Debouncer&&) = delete;
+    ~Debouncer() = default;
+
+    /// @brief Takes the current levels as debounced states, without reporting edges.
+    /// @details Called once the pins are configured.
+    void Prime()
+    {
+      for (std::size_t index = 0; index < PortCount; ++index)
+      {
+        counters[index].Reset(Read(index));
+      }
+    }
+
+    /// @brief Reads the input data register of each port once and counts the samples.
+    /// @return True if any pin changed its debounced state.
+    bool Sample()
+    {
+      auto changed = false;
+
+      for (std::size_t index = 0; index < PortCount; ++index)
+      {
+        changed = (Update(index, Read(index)) != 0) || changed;
+      }
+
+      return changed;
+    }
+
+    /// @brief Counts a sample of a port.
+    /// @param index Index of the port in the template parameters.
+    /// @param sample Levels of the pins.
+    /// @return Mask of the pins which changed their debounced state.
+    uint16_t Update(const std::size_t index, const uint16_t sample)
+    {
+      auto& counter = counters[index];
+      const auto toggled = counter.Update(sample);
+
+      if (toggled != 0)
+      {
+        pressed[index].fetch_or(toggled & counter.GetState(), std::memory_order_relaxed);
+        released[index].fetch_or(toggled & ~static_cast<uint32_t>(counter.GetState()), std::memory_order_relaxed);
+      }
+
+      return toggled;
+    }
+
+    /// @brief Returns whether the pins of all ports read their debounced state at the last sample.
+    /// @return True if sampling can pause until a pin changes its level.
+    bool IsSettled() const
+    {
+      for (const auto& counter : counters)
+      {
+        if (!counter.IsSettled())
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    /// @brief Returns the debounced states of the pins of a port.
+    /// @tparam PortBase Base address of the port.
+    /// @return Debounced levels of the pins.
+    template<uintptr_t PortBase>
+    uint16_t GetState() const
+    {
+      static_assert(IndexOf(PortBase) < PortCount, "The port is not debounced");
+      return counters[IndexOf(PortBase)].GetState();
+    }
+
+    /// @brief Takes the rising edges of pins of a port, the edges of the other pins are kept.
+    /// @tparam PortBase Base address of the port.
+    /// @param mask Mask of the pins.
+    /// @return Pins of the mask which were pressed since the last call.
+    template<uintptr_t PortBase>
+    uint16_t TakePressed(const uint16_t mask)
+    {
+      static_assert(IndexOf(PortBase) < PortCount, "The port is not debounced");
+      return static_cast<uint16_t>(pressed[IndexOf(PortBase)].fetch_and(~static_cast<uint32_t>(mask)) & mask);
+    }
+
+    /// @brief Takes the falling edges of pins of a port, the edges of the other pins are kept.
+    /// @tparam PortBase Base address of the port.
+    /// @param mask Mask of the pins.
+    /// @return Pins of the mask which were released since the last call.
+    template<uintptr_t PortBase>
+    uint16_t TakeReleased(const uint16_t mask)
+    {
+      static_assert(IndexOf(PortBase) < PortCount, "The port is not debounced");
+      return static_cast<uint16_t>(released[IndexOf(PortBase)].fetch_and(~static_cast<uint32_t>(mask)) & mask);
+    }
+  };
+}  // namespace Input
+
+#endif  // INPUT_DEBOUNCER_HPP
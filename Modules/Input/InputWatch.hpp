@@ -0,0 +1,181 @@
+/// @file InputWatch.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Notifies subscribers of debounced edges, sampling the pins only while they change.
+/// @details An edge interrupt of a watched pin starts the sampling, which stops again once all pins read their
+///          debounced state. While the inputs rest, nothing is polled and the core may sleep as long as the other
+///          tasks allow. The subscribers are notified from the sample that confirms the edge, so a woken task reacts
+///          right after the debounce time. The class does not access the EXTI or the timers, the owner starts and
+///          stops the sampling, so the logic can be tested in virtual time.
+
+#ifndef INPUT_INPUTWATCH_HPP
+#define INPUT_INPUTWATCH_HPP
+
+#include <Debouncer.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Input
+{
+  /// @brief Callback notifying a subscriber of debounced edges.
+  /// @details Receives the context given at subscription and the subscribed pins which changed their state.
+  using ChangeCallback = void (*)(void* context, uint16_t changed);
+
+  /// @brief Watches pins of several GPIO ports for debounced edges.
+  /// @tparam MaxSubscriptions Maximum number of subscriptions.
+  /// @tparam PortBases Base addresses of the GPIO ports (e.g., GPIOA_BASE).
+  template<std::size_t MaxSubscriptions, uintptr_t... PortBases>
+  class InputWatch
+  {
+   public:
+    /// @brief Type of the debouncer.
+    using DebouncerType = Debouncer<PortBases...>;
+
+    /// @brief Ticks between two samples while a pin changes.
+    static constexpr uint32_t SamplePeriod = 5;
+
+   private:
+    /// @brief Subscription to pins of a port.
+    struct Subscription
+    {
+      /// @brief Callback invoked on debounced edges of the pins.
+      ChangeCallback callback = nullptr;
+
+      /// @brief Context passed to the callback.
+      void* context = nullptr;
+
+      /// @brief Subscribed pins.
+      uint16_t mask = 0;
+
+      /// @brief Index of the port.
+      uint8_t port = 0;
+    };
+
+    /// @brief Debouncer of the watched ports.
+    DebouncerType debouncer;
+
+    /// @brief Subscriptions, the first `subscriptionCount` are used.
+    std::array<Subscription, MaxSubscriptions> subscriptions {};
+
+    /// @brief Number of subscriptions.
+    std::size_t subscriptionCount = 0;
+
+    /// @brief Whether the pins are sampled.
+    std::atomic<bool> sampling {false};
+
+   public:
+    /// @brief Constructor for the InputWatch class.
+    constexpr InputWatch() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    InputWatch(const InputWatch&) = delete;
+    InputWatch& operator=(const InputWatch&) = delete;
+    InputWatch(InputWatch&&) = delete;
+    InputWatch& operator=(InputWatch&&) = delete;
+    ~InputWatch() = default;
+
+    /// @brief Subscribes to debounced edges of pins of a port.
+    /// @tparam PortBase Base address of the port.
+    /// @param mask Mask of the pins.
+    /// @param callback Callback invoked from the sample confirming an edge, it has to be short.
+    /// @param context Context passed to the callback.
+    /// @return True if subscribed, false if all subscriptions are used.
+    /// @details Called before the sampling is started for the first time.
+    template<uintptr_t PortBase>
+    bool Subscribe(const uint16_t mask, const ChangeCallback callback, void* context)
+    {
+      static_assert(DebouncerType::IndexOf(PortBase) < DebouncerType::PortCount, "The port is not watched");
+
+      if (subscriptionCount == MaxSubscriptions)
+      {
+        return false;
+      }
+
+      subscriptions[subscriptionCount++] = Subscription {
+        .callback = callback,
+        .context = context,
+        .mask = mask,
+        .port = static_cast<uint8_t>(DebouncerType::IndexOf(PortBase)),
+      };
+
+      return true;
+    }
+
+    /// @brief Takes the current levels as debounced states, without notifying.
+    void Prime()
+    {
+      debouncer.Prime();
+    }
+
+    /// @brief Records an edge of a watched pin, called by its interrupt.
+    /// @return True if the sampling has to be started, false if it already runs.
+    bool OnEdge()
+    {
+      return !sampling.exchange(true, std::memory_order_acq_rel);
+    }
+
+    /// @brief Counts a sample of all ports and notifies the subscribers of the pins which changed.
+    /// @param samples Levels of the pins per port.
+    /// @return True if the sampling has to go on, false if all pins settled and it has to be stopped.
+    /// @details Runs at a higher priority than the edge interrupts, which start the sampling again for an edge after
+    ///          the last sample.
+    bool Update(const std::array<uint16_t, DebouncerType::PortCount>& samples)
+    {
+      for (std::size_t index = 0; index < DebouncerType::PortCount; ++index)
+      {
+        const auto changed = debouncer.Update(index, samples[index]);
+
+        for (std::size_t subscription = 0; changed != 0 && subscription < subscriptionCount; ++subscription)
+        {
+          const auto& entry = subscriptions[subscription];
+
+          if (entry.port == index && (entry.mask & changed) != 0)
+          {
+            entry.callback(entry.context, static_cast<uint16_t>(entry.mask & changed));
+          }
+        }
+      }
+
+      if (!debouncer.IsSettled())
+      {
+        return true;
+      }
+
+      sampling.store(false, std::memory_order_release);
+      return false;
+    }
+
+    /// @brief Reads the input data register of each port once and counts the samples.
+    /// @return True if the sampling has to go on, false if all pins settled and it has to be stopped.
+    bool Sample()
+    {
+      std::array<uint16_t, DebouncerType::PortCount> samples {};
+
+      for (std::size_t index = 0; index < samples.size(); ++index)
+      {
+        samples[index] = DebouncerType::Read(index);
+      }
+
+      return Update(samples);
+    }
+
+    /// @brief Returns whether the pins are sampled.
+    /// @return True between the first edge and the sample at which all pins settled.
+    bool IsSampling() const
+    {
+      return sampling.load(std::memory_order_acquire);
+    }
+
+    /// @brief Returns the debouncer, whose states and edge masks the tasks read.
+    /// @return Reference to the debouncer.
+    DebouncerType& GetDebouncer()
+    {
+      return debouncer;
+    }
+  };
+}  // namespace Input
+
+#endif  // INPUT_INPUTWATCH_HPP
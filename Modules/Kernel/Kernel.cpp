@@ -0,0 +1,200 @@
+/// @file Kernel.cpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Fixed priority preemptive kernel.
+
+#include <stm32f1xx.h>
+
+#include <CriticalSection.hpp>
+#include <Kernel.hpp>
+#include <cstdint>
+
+using Peripherals::KernelLock;
+
+// NOLINTBEGIN
+extern "C"
+{
+  /// @brief Control block of the running thread, used by the context switch.
+  Kernel::ThreadControlBlock* volatile kernelCurrentThread = nullptr;
+
+  /// @brief Control block of the thread to switch to, used by the context switch.
+  Kernel::ThreadControlBlock* volatile kernelNextThread = nullptr;
+}
+// NOLINTEND
+
+namespace
+{
+  /// @brief Returns the 32 bit address of a function or object, as stored in an exception frame.
+  /// @param pointer Pointer to convert.
+  /// @return Address of the pointer.
+  template<class Pointer>
+  uint32_t GetAddress(Pointer pointer)
+  {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer));
+  }
+
+  /// @brief Pends the context switch, which runs once no other interrupt is active.
+  void RequestContextSwitch()
+  {
+#if defined(__arm__)
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#endif
+  }
+}  // namespace
+
+namespace Kernel
+{
+  void Kernel::CreateThread(const std::size_t priority,
+    void (*entry)(void*),
+    void* argument,
+    const std::span<uint32_t> stack)
+  {
+    threads[priority] = ThreadControlBlock {
+      .stackPointer = BuildInitialFrame(stack, GetAddress(entry), GetAddress(argument), GetAddress(&ExitThread)),
+      .stack = stack,
+    };
+
+    scheduler.MakeReady(priority);
+  }
+
+  void Kernel::Start()
+  {
+    {
+      const KernelLock lock;
+      running = scheduler.Select();
+      kernelCurrentThread = &threads[running];
+      kernelNextThread = kernelCurrentThread;
+    }
+
+#if defined(__arm__)
+    // The SVC handler restores the first thread, the main stack is only used by interrupt handlers from now on
+    __asm volatile("svc 0");
+#endif
+
+    for (;;)
+    {
+    }
+  }
+
+  void Kernel::OnTick(const uint32_t tick)
+  {
+    now = tick;
+    scheduler.Tick(tick);
+    Reschedule();
+  }
+
+  void Kernel::SleepUntil(const uint32_t deadline)
+  {
+    const KernelLock lock;
+    scheduler.SleepUntil(running, deadline, now);
+    Reschedule();
+  }
+
+  void Kernel::Wait(SignalState& signal)
+  {
+    const KernelLock lock;
+
+    if (scheduler.Wait(running, signal))
+    {
+      Reschedule();
+    }
+  }
+
+  void Kernel::Notify(SignalState& signal)
+  {
+    const KernelLock lock;
+    scheduler.Notify(signal);
+    Reschedule();
+  }
+
+  uint32_t Kernel::GetNextWakeup(const uint32_t fallback) const
+  {
+    return scheduler.GetNextWakeup(fallback);
+  }
+
+  std::size_t Kernel::GetUnusedStack(const std::size_t priority) const
+  {
+    return GetUnusedWords(threads[priority].stack) * sizeof(uint32_t);
+  }
+
+  void Kernel::Reschedule()
+  {
+    const auto next = scheduler.Select();
+
+    // Nothing to do before the kernel is started or if the running thread keeps the processor
+    if (running == SchedulerType::NoThread || next == SchedulerType::NoThread || next == running)
+    {
+      return;
+    }
+
+    running = next;
+    kernelNextThread = &threads[next];
+    RequestContextSwitch();
+  }
+
+  void Kernel::ExitThread()
+  {
+    {
+      const KernelLock lock;
+      kernel.scheduler.Block(kernel.running);
+      kernel.Reschedule();
+    }
+
+    for (;;)
+    {
+    }
+  }
+
+  void Signal::Wait()
+  {
+    kernel.Wait(state);
+  }
+
+  void Signal::Set()
+  {
+    kernel.Notify(state);
+  }
+}  // namespace Kernel
+
+#if defined(__arm__)
+// NOLINTBEGIN
+/// @brief Starts the first thread by an exception return to the process stack.
+extern "C" __attribute__((naked)) void SVC_Handler()
+{
+  __asm volatile(
+    "ldr r3, =kernelCurrentThread \n"
+    "ldr r1, [r3]                 \n"
+    "ldr r0, [r1]                 \n"
+    "ldmia r0!, {r4-r11}          \n"
+    "msr psp, r0                  \n"
+    "isb                          \n"
+    "mvn lr, #2                   \n"  // EXC_RETURN 0xFFFFFFFD, thread mode with process stack
+    "bx lr                        \n");
+}
+
+/// @brief Saves the context of the running thread and restores the one of the next thread.
+/// @details The hardware already stacked R0 to R3, R12, LR, PC and xPSR on the process stack, the handler only saves
+///          and restores R4 to R11.
+extern "C" __attribute__((naked)) void PendSV_Handler()
+{
+  __asm volatile(
+    "mrs r0, psp                  \n"
+    "ldr r3, =kernelCurrentThread \n"
+    "ldr r2, [r3]                 \n"
+    "stmdb r0!, {r4-r11}          \n"
+    "str r0, [r2]                 \n"
+    "cpsid i                      \n"
+    "ldr r1, =kernelNextThread    \n"
+    "ldr r1, [r1]                 \n"
+    "str r1, [r3]                 \n"
+    "cpsie i                      \n"
+    "ldr r0, [r1]                 \n"
+    "ldmia r0!, {r4-r11}          \n"
+    "msr psp, r0                  \n"
+    "isb                          \n"
+    "bx lr                        \n");
+}
+// NOLINTEND
+#endif
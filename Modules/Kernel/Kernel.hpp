@@ -0,0 +1,142 @@
+/// @file Kernel.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Fixed priority preemptive kernel.
+/// @details Threads run on the process stack and are switched in the PendSV handler, which has the lowest interrupt
+///          priority. An interrupt handler waking a thread with a higher priority than the running one only pends
+///          PendSV, so the switch happens as soon as the last interrupt returns. The first thread is started by SVC.
+
+#ifndef KERNEL_KERNEL_HPP
+#define KERNEL_KERNEL_HPP
+
+#include <PriorityScheduler.hpp>
+#include <ThreadStack.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Kernel
+{
+  /// @brief Maximum number of threads.
+  constexpr std::size_t MaxThreads = 4;
+
+  /// @brief Type of the scheduling decisions.
+  using SchedulerType = PriorityScheduler<MaxThreads>;
+
+  /// @brief Control block of a thread.
+  /// @details The stack pointer has to be the first member, the context switch accesses it without an offset.
+  struct ThreadControlBlock
+  {
+    /// @brief Saved process stack pointer while the thread is not running.
+    uint32_t* stackPointer;
+
+    /// @brief Stack of the thread.
+    std::span<uint32_t> stack;
+  };
+
+  /// @brief Fixed priority preemptive kernel.
+  class Kernel
+  {
+   private:
+    /// @brief Scheduling decisions.
+    SchedulerType scheduler;
+
+    /// @brief Control blocks of the threads, indexed by priority.
+    std::array<ThreadControlBlock, MaxThreads> threads {};
+
+    /// @brief Index of the thread which runs or runs after the pending context switch.
+    std::size_t running = SchedulerType::NoThread;
+
+    /// @brief Last tick passed to `OnTick`.
+    uint32_t now = 0;
+
+    /// @brief Hands the processor to the ready thread with the highest priority, if it is not the running one.
+    /// @details Has to be called with disabled interrupts.
+    void Reschedule();
+
+    /// @brief Called if a thread function returns, blocks the thread forever.
+    [[noreturn]] static void ExitThread();
+
+   public:
+    /// @brief Constructor for the Kernel class.
+    constexpr Kernel() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    Kernel(const Kernel&) = delete;
+    Kernel& operator=(const Kernel&) = delete;
+    Kernel(Kernel&&) = delete;
+    Kernel& operator=(Kernel&&) = delete;
+    ~Kernel() = default;
+
+    /// @brief Creates a thread, which is ready to run once the kernel is started.
+    /// @param priority Unique priority of the thread, 0 is the highest one.
+    /// @param entry Thread function.
+    /// @param argument Argument passed to the thread function.
+    /// @param stack Statically allocated stack of the thread.
+    /// @details The thread with the lowest priority must never block, it is the idle thread of the kernel.
+    void CreateThread(std::size_t priority, void (*entry)(void*), void* argument, std::span<uint32_t> stack);
+
+    /// @brief Starts the thread with the highest priority, never returns.
+    [[noreturn]] void Start();
+
+    /// @brief Advances the kernel time and wakes the threads whose deadline is reached.
+    /// @param tick Current tick.
+    /// @details Called by the SysTick interrupt handler.
+    void OnTick(uint32_t tick);
+
+    /// @brief Lets the running thread sleep until the deadline is reached.
+    /// @param deadline Tick at which the thread becomes ready again.
+    void SleepUntil(uint32_t deadline);
+
+    /// @brief Lets the running thread wait for a signal.
+    /// @param signal Signal to wait for.
+    void Wait(SignalState& signal);
+
+    /// @brief Sets a signal, can be called from interrupt handlers.
+    /// @param signal Signal to set.
+    void Notify(SignalState& signal);
+
+    /// @brief Returns the earliest tick at which a sleeping thread has to run.
+    /// @param fallback Tick returned if no thread sleeps.
+    /// @return Earliest deadline, or the fallback if it is earlier.
+    uint32_t GetNextWakeup(uint32_t fallback) const;
+
+    /// @brief Returns the number of bytes of a stack which have never been used.
+    /// @param priority Priority of the thread.
+    /// @return Unused stack space in bytes.
+    std::size_t GetUnusedStack(std::size_t priority) const;
+  };
+
+  /// @brief Signal, which threads can wait for and interrupt handlers can set.
+  class Signal
+  {
+   private:
+    /// @brief State of the signal.
+    SignalState state;
+
+   public:
+    /// @brief Constructor for the Signal class.
+    constexpr Signal() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+    Signal(Signal&&) = delete;
+    Signal& operator=(Signal&&) = delete;
+    ~Signal() = default;
+
+    /// @brief Lets the running thread wait until the signal is set.
+    void Wait();
+
+    /// @brief Sets the signal, can be called from interrupt handlers.
+    void Set();
+  };
+
+  /// @brief Kernel instance used by the threads and the interrupt handlers.
+  /// @details Constant initialized, so interrupt handlers can use it before any constructor ran.
+  inline constinit Kernel kernel {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace Kernel
+
+#endif  // KERNEL_KERNEL_HPP
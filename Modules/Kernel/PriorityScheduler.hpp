@@ -0,0 +1,189 @@
+/// @file PriorityScheduler.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Scheduling decisions of the preemptive kernel.
+/// @details Every thread owns a unique fixed priority, which is its index. The states are kept in bit masks, so the
+///          decision which thread runs next does not depend on the number of threads. The class does not touch any
+///          core register and is therefore tested on the host, the kernel only applies its decisions.
+
+#ifndef KERNEL_PRIORITYSCHEDULER_HPP
+#define KERNEL_PRIORITYSCHEDULER_HPP
+
+#include <Scheduler.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Kernel
+{
+  /// @brief State of a signal, which threads can wait for.
+  /// @details The signal behaves like a binary semaphore. Setting it without a waiting thread latches it, so the next
+  ///          wait returns immediately.
+  struct SignalState
+  {
+    /// @brief Bit mask of the threads waiting for the signal.
+    uint32_t waiters = 0;
+
+    /// @brief Whether the signal was set without a waiting thread.
+    bool pending = false;
+  };
+
+  /// @brief Fixed priority scheduling decisions for up to 32 threads.
+  /// @tparam MaxThreads Maximum number of threads, a lower index is a higher priority.
+  template<std::size_t MaxThreads>
+  class PriorityScheduler
+  {
+   private:
+    static_assert(MaxThreads > 0 && MaxThreads <= 32, "The thread states are tracked in a single word");
+
+    /// @brief Bit mask of the threads which are ready to run.
+    uint32_t ready = 0;
+
+    /// @brief Bit mask of the threads which sleep until their deadline.
+    uint32_t sleeping = 0;
+
+    /// @brief Wake up ticks of the sleeping threads.
+    std::array<uint32_t, MaxThreads> deadlines {};
+
+    /// @brief Returns the bit of a thread.
+    /// @param thread Index of the thread.
+    /// @return Bit mask with only the bit of the thread set.
+    static constexpr uint32_t Bit(const std::size_t thread)
+    {
+      return uint32_t {1} << thread;
+    }
+
+   public:
+    /// @brief Index returned if no thread is ready.
+    static constexpr std::size_t NoThread = MaxThreads;
+
+    /// @brief Constructor for the PriorityScheduler class.
+    constexpr PriorityScheduler() = default;
+
+    /// @brief Returns the thread which has to run.
+    /// @return Index of the ready thread with the highest priority or `NoThread`.
+    constexpr std::size_t Select() const
+    {
+      return ready == 0 ? NoThread : static_cast<std::size_t>(std::countr_zero(ready));
+    }
+
+    /// @brief Returns whether the running thread has to be preempted.
+    /// @param running Index of the running thread.
+    /// @return True if another thread has to run.
+    constexpr bool IsPreemptionRequired(const std::size_t running) const
+    {
+      return Select() != running;
+    }
+
+    /// @brief Returns whether a thread is ready to run.
+    /// @param thread Index of the thread.
+    /// @return True if the thread is ready.
+    constexpr bool IsReady(const std::size_t thread) const
+    {
+      return (ready & Bit(thread)) != 0;
+    }
+
+    /// @brief Makes a thread ready to run, e.g. when it is created.
+    /// @param thread Index of the thread.
+    constexpr void MakeReady(const std::size_t thread)
+    {
+      sleeping &= ~Bit(thread);
+      ready |= Bit(thread);
+    }
+
+    /// @brief Blocks a thread until it is made ready again.
+    /// @param thread Index of the thread.
+    constexpr void Block(const std::size_t thread)
+    {
+      ready &= ~Bit(thread);
+      sleeping &= ~Bit(thread);
+    }
+
+    /// @brief Lets a thread sleep until the deadline is reached.
+    /// @param thread Index of the thread.
+    /// @param deadline Tick at which the thread becomes ready again.
+    /// @param now Current tick.
+    constexpr void SleepUntil(const std::size_t thread, const uint32_t deadline, const uint32_t now)
+    {
+      if (Scheduler::IsDue(now, deadline))
+      {
+        return;
+      }
+
+      ready &= ~Bit(thread);
+      sleeping |= Bit(thread);
+      deadlines[thread] = deadline;
+    }
+
+    /// @brief Wakes all sleeping threads whose deadline is reached.
+    /// @param now Current tick.
+    constexpr void Tick(const uint32_t now)
+    {
+      for (auto remaining = sleeping; remaining != 0; remaining &= remaining - 1)
+      {
+        const auto thread = static_cast<std::size_t>(std::countr_zero(remaining));
+
+        if (Scheduler::IsDue(now, deadlines[thread]))
+        {
+          MakeReady(thread);
+        }
+      }
+    }
+
+    /// @brief Returns the earliest deadline of the sleeping threads.
+    /// @param fallback Tick returned if no thread sleeps.
+    /// @return Earliest deadline, or the fallback if it is earlier.
+    constexpr uint32_t GetNextWakeup(const uint32_t fallback) const
+    {
+      auto next = fallback;
+
+      for (auto remaining = sleeping; remaining != 0; remaining &= remaining - 1)
+      {
+        const auto thread = static_cast<std::size_t>(std::countr_zero(remaining));
+
+        if (Scheduler::IsDue(next, deadlines[thread]))
+        {
+          next = deadlines[thread];
+        }
+      }
+
+      return next;
+    }
+
+    /// @brief Lets a thread wait for a signal.
+    /// @param thread Index of the thread.
+    /// @param signal Signal to wait for.
+    /// @return True if the thread is blocked, false if the signal was pending and has been consumed.
+    constexpr bool Wait(const std::size_t thread, SignalState& signal)
+    {
+      if (signal.pending)
+      {
+        signal.pending = false;
+        return false;
+      }
+
+      Block(thread);
+      signal.waiters |= Bit(thread);
+      return true;
+    }
+
+    /// @brief Sets a signal, waking the waiting thread with the highest priority.
+    /// @param signal Signal to set.
+    constexpr void Notify(SignalState& signal)
+    {
+      if (signal.waiters == 0)
+      {
+        signal.pending = true;
+        return;
+      }
+
+      const auto thread = static_cast<std::size_t>(std::countr_zero(signal.waiters));
+      signal.waiters &= ~Bit(thread);
+      MakeReady(thread);
+    }
+  };
+}  // namespace Kernel
+
+#endif  // KERNEL_PRIORITYSCHEDULER_HPP
@@ -0,0 +1,99 @@
+/// @file ThreadStack.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Statically allocated thread stacks and their initial exception frame.
+/// @details A thread is started by an exception return, so its stack is prepared as if the thread had been
+///          interrupted right before its first instruction.
+
+#ifndef KERNEL_THREADSTACK_HPP
+#define KERNEL_THREADSTACK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Kernel
+{
+  /// @brief Pattern the stacks are filled with to measure their usage.
+  constexpr uint32_t StackPattern = 0xDEADBEEF;
+
+  /// @brief Number of words of the frame saved by the hardware on exception entry.
+  constexpr std::size_t HardwareFrameWords = 8;
+
+  /// @brief Number of words of the frame saved by the context switch, registers R4 to R11.
+  constexpr std::size_t SoftwareFrameWords = 8;
+
+  /// @brief Initial program status register value, only the Thumb bit is set.
+  constexpr uint32_t InitialProgramStatus = 0x01000000;
+
+  /// @brief Statically allocated stack of a thread.
+  /// @tparam Size Size of the stack in bytes.
+  template<std::size_t Size>
+  struct ThreadStack
+  {
+    static_assert(Size % 8 == 0, "The stack has to keep the 8 byte alignment of the exception frame");
+    static_assert(Size / sizeof(uint32_t) >= 2 * (HardwareFrameWords + SoftwareFrameWords), "Stack is too small");
+
+    /// @brief Storage of the stack.
+    alignas(8) std::array<uint32_t, Size / sizeof(uint32_t)> words;
+  };
+
+  /// @brief Fills a stack with the pattern and places the initial frame on top.
+  /// @param stack Stack of the thread.
+  /// @param entry Address of the thread function.
+  /// @param argument Argument passed in R0 to the thread function.
+  /// @param exit Address returned to, if the thread function returns.
+  /// @return Stack pointer of the prepared thread, pointing to the saved R4.
+  inline uint32_t* BuildInitialFrame(std::span<uint32_t> stack,
+    const uint32_t entry,
+    const uint32_t argument,
+    const uint32_t exit)
+  {
+    stack = stack.first(stack.size() & ~std::size_t {1});
+
+    for (auto& word : stack)
+    {
+      word = StackPattern;
+    }
+
+    auto frame = stack.last(HardwareFrameWords + SoftwareFrameWords);
+
+    // Registers R4 to R11 restored by the context switch
+    for (std::size_t i = 0; i < SoftwareFrameWords; ++i)
+    {
+      frame[i] = 0;
+    }
+
+    // Registers R0 to R3, R12, LR, PC and xPSR restored by the exception return
+    auto hardwareFrame = frame.last(HardwareFrameWords);
+    hardwareFrame[0] = argument;
+    hardwareFrame[1] = 0;
+    hardwareFrame[2] = 0;
+    hardwareFrame[3] = 0;
+    hardwareFrame[4] = 0;
+    hardwareFrame[5] = exit;
+    hardwareFrame[6] = entry & ~uint32_t {1};
+    hardwareFrame[7] = InitialProgramStatus;
+
+    return frame.data();
+  }
+
+  /// @brief Returns the number of words of a stack which have never been used.
+  /// @param stack Stack of the thread, filled by `BuildInitialFrame`.
+  /// @return Number of words from the bottom of the stack which still hold the pattern.
+  inline std::size_t GetUnusedWords(std::span<const uint32_t> stack)
+  {
+    std::size_t unused = 0;
+
+    while (unused < stack.size() && stack[unused] == StackPattern)
+    {
+      ++unused;
+    }
+
+    return unused;
+  }
+}  // namespace Kernel
+
+#endif  // KERNEL_THREADSTACK_HPP
@@ -0,0 +1,225 @@
+/// @file DeferredLog.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Log whose records are written by interrupt handlers and formatted by a thread.
+/// @details Formatting and transmitting a line over USART1 takes about 1 ms per 11 characters, which no interrupt
+///          handler may spend. Writing a record only copies the address of the format string, the tick and the raw
+///          arguments into a slot of a ring buffer, which takes a few dozen cycles. A thread formats and transmits
+///          the records later. Any interrupt handler and any thread may write, a writer preempted while filling its
+///          slot only holds back the records behind it, never another writer. A full buffer drops the record and
+///          counts it, so a writer never waits.
+
+#ifndef LOGGING_DEFERREDLOG_HPP
+#define LOGGING_DEFERREDLOG_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+
+namespace Logging
+{
+  /// @brief Maximum number of arguments of a record.
+  constexpr std::size_t MaxArguments = 3;
+
+  /// @brief Maximum length of a formatted line, including the terminating null character.
+  constexpr std::size_t MaxLineLength = 96;
+
+  /// @brief Argument of a record, an integer or enumeration of at most 32 bits.
+  template<typename T>
+  concept LogArgument = (std::integral<T> || std::is_enum_v<T>) && (sizeof(T) <= sizeof(uint32_t));
+
+  /// @brief Record of a log line, formatted when the log is flushed.
+  struct Record
+  {
+    /// @brief Format string, a string literal whose address serves as ID of the message.
+    const char* format;
+
+    /// @brief Tick at which the record was written.
+    uint32_t tick;
+
+    /// @brief Raw arguments, passed to the format as unsigned long.
+    std::array<uint32_t, MaxArguments> arguments;
+  };
+
+  /// @brief Callback writing a formatted line.
+  /// @details Receives the context given to `Flush()`, the line and its length without the null character.
+  using LineWriter = void (*)(void* context, const char* line, std::size_t length);
+
+  /// @brief Log buffering records from interrupt handlers and threads until a thread flushes them.
+  /// @tparam Capacity Maximum number of buffered records, has to be a power of two.
+  /// @tparam TickSource Source of the timestamps of the records.
+  template<std::size_t Capacity, typename TickSource>
+  class DeferredLog
+  {
+   private:
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "The capacity has to be a power of two");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "The positions have to be lock free");
+
+    /// @brief Mask to map the free running positions to the slots.
+    static constexpr uint32_t IndexMask = Capacity - 1;
+
+    /// @brief Slot of the ring buffer.
+    struct Slot
+    {
+      /// @brief First position of the lap the slot is free for, plus one once the record of the lap is complete.
+      /// @details Starts at zero, so the slots are free for the first lap without initialization.
+      std::atomic<uint32_t> lap;
+
+      /// @brief Record held by the slot.
+      Record record;
+    };
+
+    /// @brief Slots of the ring buffer.
+    std::array<Slot, Capacity> slots {};
+
+    /// @brief Free running position of the next write, claimed by the writers with a compare and swap.
+    std::atomic<uint32_t> writePosition {0};
+
+    /// @brief Free running position of the next read, written by the flushing thread only.
+    uint32_t readPosition = 0;
+
+    /// @brief Number of records dropped because the buffer was full.
+    std::atomic<uint32_t> dropped {0};
+
+    /// @brief Dropped records already reported by `Flush()`.
+    uint32_t reportedDropped = 0;
+
+    /// @brief Claims a slot and copies a record into it.
+    /// @param format Format string.
+    /// @param arguments Raw arguments.
+    /// @return True if the record was buffered, false if it was dropped.
+    bool Push(const char* format, const std::array<uint32_t, MaxArguments>& arguments)
+    {
+      auto position = writePosition.load(std::memory_order_relaxed);
+
+      for (;;)
+      {
+        auto& slot = slots[position & IndexMask];
+        const auto lap = position & ~IndexMask;
+        const auto distance = static_cast<int32_t>(slot.lap.load(std::memory_order_acquire) - lap);
+
+        if (distance < 0)
+        {
+          // The slot still holds the record written one lap earlier
+          dropped.fetch_add(1, std::memory_order_relaxed);
+          return false;
+        }
+
+        if (distance > 0)
+        {
+          // Another writer claimed the position meanwhile
+          position = writePosition.load(std::memory_order_relaxed);
+          continue;
+        }
+
+        if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+          slot.record = Record {
+            .format = format,
+            .tick = TickSource::Now(),
+            .arguments = arguments,
+          };
+          slot.lap.store(lap + 1, std::memory_order_release);
+
+          return true;
+        }
+      }
+    }
+
+   public:
+    /// @brief Constructor for the DeferredLog class.
+    constexpr DeferredLog() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    DeferredLog(const DeferredLog&) = delete;
+    DeferredLog& operator=(const DeferredLog&) = delete;
+    DeferredLog(DeferredLog&&) = delete;
+    DeferredLog& operator=(DeferredLog&&) = delete;
+    ~DeferredLog() = default;
+
+    /// @brief Buffers a record, may be called from any interrupt handler or thread.
+    /// @tparam Arguments Types of the arguments.
+    /// @param format Format string, it has to outlive the record, e.g. a string literal. The arguments are passed as
+    ///        unsigned long, so they are formatted with the l length modifier.
+    /// @param arguments Arguments of the format.
+    /// @return True if the record was buffered, false if it was dropped because the buffer was full.
+    template<LogArgument... Arguments>
+    bool Write(const char* format, const Arguments... arguments)
+    {
+      static_assert(sizeof...(Arguments) <= MaxArguments, "A record holds at most MaxArguments arguments");
+
+      return Push(format, std::array<uint32_t, MaxArguments> {static_cast<uint32_t>(arguments)...});
+    }
+
+    /// @brief Takes the oldest complete record, may only be called by the flushing thread.
+    /// @param record Record to copy the oldest one to.
+    /// @return True if a record was taken, false if none is complete.
+    bool Pop(Record& record)
+    {
+      auto& slot = slots[readPosition & IndexMask];
+      const auto lap = readPosition & ~IndexMask;
+
+      if (slot.lap.load(std::memory_order_acquire) != lap + 1)
+      {
+        return false;
+      }
+
+      record = slot.record;
+      slot.lap.store(lap + Capacity, std::memory_order_release);
+      ++readPosition;
+
+      return true;
+    }
+
+    /// @brief Formats and writes the buffered records, may only be called by one thread.
+    /// @param writer Callback writing the formatted lines.
+    /// @param context Context passed to the writer.
+    /// @return Number of written records.
+    /// @details Each line is prefixed with the tick of its record. Records dropped since the last flush are reported
+    ///          by an additional line.
+    std::size_t Flush(const LineWriter writer, void* context)
+    {
+      std::array<char, MaxLineLength> line {};
+      std::size_t written = 0;
+      Record record {};
+
+      while (Pop(record))
+      {
+        const auto prefix = std::snprintf(line.data(), line.size(), "%8lu ", static_cast<unsigned long>(record.tick));
+        const auto length = prefix + std::snprintf(line.data() + prefix,
+                                       line.size() - static_cast<std::size_t>(prefix),
+                                       record.format,
+                                       static_cast<unsigned long>(record.arguments[0]),
+                                       static_cast<unsigned long>(record.arguments[1]),
+                                       static_cast<unsigned long>(record.arguments[2]));
+        writer(context, line.data(), std::min(static_cast<std::size_t>(length), line.size() - 1));
+        ++written;
+      }
+
+      if (const auto lost = dropped.load(std::memory_order_relaxed); lost != reportedDropped)
+      {
+        const auto length = std::snprintf(
+          line.data(), line.size(), "%lu log records dropped\n", static_cast<unsigned long>(lost - reportedDropped));
+        writer(context, line.data(), std::min(static_cast<std::size_t>(length), line.size() - 1));
+        reportedDropped = lost;
+      }
+
+      return written;
+    }
+
+    /// @brief Returns the number of records dropped because the buffer was full.
+    /// @return Number of dropped records since startup.
+    uint32_t GetDropped() const
+    {
+      return dropped.load(std::memory_order_relaxed);
+    }
+  };
+}  // namespace Logging
+
+#endif  // LOGGING_DEFERREDLOG_HPP
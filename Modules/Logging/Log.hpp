@@ -0,0 +1,40 @@
+/// @file Log.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Deferred log of the application, flushed by the event thread.
+
+#ifndef LOGGING_LOG_HPP
+#define LOGGING_LOG_HPP
+
+#include <DeferredLog.hpp>
+#include <Events.hpp>
+#include <Rcc.hpp>
+#include <cstddef>
+
+namespace Logging
+{
+  /// @brief Capacity of the application log, each record takes 24 bytes of RAM.
+  constexpr std::size_t LogCapacity = 16;
+
+  /// @brief Type of the application log, whose records are stamped with the millisecond tick.
+  using LogType = DeferredLog<LogCapacity, Peripherals::Rcc::SysTickSource>;
+
+  /// @brief Log of the application.
+  /// @details Constant initialized, so interrupt handlers may write to it before any constructor ran.
+  inline constinit LogType deferredLog {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Buffers a log record and wakes the event thread, which formats and transmits it.
+  /// @tparam Arguments Types of the arguments.
+  /// @param format Format string literal, its integer conversions take the l length modifier.
+  /// @param arguments Arguments of the format.
+  /// @details Takes a few dozen cycles and never blocks, so it may be called from any interrupt handler.
+  template<LogArgument... Arguments>
+  inline void Log(const char* format, const Arguments... arguments)
+  {
+    deferredLog.Write(format, arguments...);
+    Events::interruptSignal.Set();
+  }
+}  // namespace Logging
+
+#endif  // LOGGING_LOG_HPP
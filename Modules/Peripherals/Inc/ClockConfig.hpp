@@ -0,0 +1,288 @@
+/// @file ClockConfig.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Compile time solver for the clock tree of the STM32F103.
+/// @details `SolveClockConfig` derives the clock source, PLL multiplier, bus prescalers, flash wait states and the
+///          resulting bus frequencies from a target system clock. The register values are computed together with the
+///          frequencies, so the drivers deriving their dividers from the frequencies always match the hardware.
+
+#ifndef PERIPHERALS_INC_CLOCKCONFIG_HPP
+#define PERIPHERALS_INC_CLOCKCONFIG_HPP
+
+#include <stm32f1xx.h>
+
+#include <array>
+#include <cstdint>
+
+namespace Peripherals::Rcc
+{
+  /// @brief Clock source of the system clock.
+  enum class ClockSource : uint8_t
+  {
+    /// @brief Internal 8 MHz RC oscillator.
+    Hsi = 0,
+
+    /// @brief External crystal oscillator.
+    Hse = 1,
+
+    /// @brief Phase locked loop.
+    Pll = 2,
+  };
+
+  /// @brief Frequency of the internal RC oscillator in Hz.
+  constexpr uint32_t HsiFrequency = 8'000'000;
+
+  /// @brief Frequency of the external crystal on the board in Hz.
+  constexpr uint32_t HseFrequency = 8'000'000;
+
+  /// @brief Frequency of the low speed external crystal on the board in Hz, it clocks the real time clock.
+  constexpr uint32_t LseFrequency = 32'768;
+
+  /// @brief Maximum frequency of the system clock, AHB and APB2 in Hz.
+  constexpr uint32_t MaxSystemClock = 72'000'000;
+
+  /// @brief Maximum frequency of APB1 in Hz.
+  constexpr uint32_t MaxApb1Clock = 36'000'000;
+
+  /// @brief Maximum frequency of the ADC clock in Hz.
+  constexpr uint32_t MaxAdcClock = 14'000'000;
+
+  /// @brief Minimum output frequency of the PLL in Hz.
+  constexpr uint32_t MinPllClock = 16'000'000;
+
+  /// @brief Maximum system clock per flash wait state in Hz.
+  constexpr uint32_t FlashClockPerWaitState = 24'000'000;
+
+  /// @brief Clock tree configuration with the resulting bus frequencies.
+  struct ClockConfig
+  {
+    /// @brief True if the requested system clock is reachable.
+    bool valid;
+
+    /// @brief Source of the system clock.
+    ClockSource source;
+
+    /// @brief True if the PLL input is the external crystal, the internal oscillator is divided by two otherwise.
+    bool pllFromHse;
+
+    /// @brief True if the external crystal is divided by two before the PLL.
+    bool hseDividedByTwo;
+
+    /// @brief PLL multiplier, 2 to 16.
+    uint32_t pllMultiplier;
+
+    /// @brief Divider of APB1, 1 to 16.
+    uint32_t apb1Divider;
+
+    /// @brief Divider of APB2, 1 to 16.
+    uint32_t apb2Divider;
+
+    /// @brief Divider of the ADC clock from APB2, 2 to 8.
+    uint32_t adcDivider;
+
+    /// @brief Flash wait states, 0 to 2.
+    uint32_t flashLatency;
+
+    /// @brief True if the USB clock of 48 MHz can be derived from the PLL.
+    bool usbAvailable;
+
+    /// @brief System clock in Hz.
+    uint32_t systemClock;
+
+    /// @brief AHB clock in Hz, it drives the core, SysTick and DWT.
+    uint32_t ahbClock;
+
+    /// @brief APB1 clock in Hz, it drives USART2 and USART3.
+    uint32_t apb1Clock;
+
+    /// @brief APB2 clock in Hz, it drives USART1 and the GPIO ports.
+    uint32_t apb2Clock;
+
+    /// @brief Clock of TIM2 to TIM4 in Hz, twice APB1 if APB1 is divided.
+    uint32_t apb1TimerClock;
+
+    /// @brief Clock of TIM1 in Hz, twice APB2 if APB2 is divided.
+    uint32_t apb2TimerClock;
+
+    /// @brief ADC clock in Hz.
+    uint32_t adcClock;
+
+    /// @brief Returns the value of the clock configuration register.
+    /// @return Value of RCC->CFGR selecting the PLL, prescalers and the system clock source.
+    constexpr uint32_t GetConfigurationRegister() const
+    {
+      constexpr std::array<uint32_t, 17> apbPrescalers = {0,
+        RCC_CFGR_PPRE1_DIV1,
+        RCC_CFGR_PPRE1_DIV2,
+        0,
+        RCC_CFGR_PPRE1_DIV4,
+        0,
+        0,
+        0,
+        RCC_CFGR_PPRE1_DIV8,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        RCC_CFGR_PPRE1_DIV16};
+      constexpr std::array<uint32_t, 9> adcPrescalers = {
+        0, 0, RCC_CFGR_ADCPRE_DIV2, 0, RCC_CFGR_ADCPRE_DIV4, 0, RCC_CFGR_ADCPRE_DIV6, 0, RCC_CFGR_ADCPRE_DIV8};
+
+      auto value = RCC_CFGR_HPRE_DIV1 | apbPrescalers[apb1Divider] |
+                   (apbPrescalers[apb2Divider] << (RCC_CFGR_PPRE2_Pos - RCC_CFGR_PPRE1_Pos)) |
+                   adcPrescalers[adcDivider];
+
+      if (source == ClockSource::Pll)
+      {
+        value |= ((pllMultiplier - 2) << RCC_CFGR_PLLMULL_Pos) | (pllFromHse ? RCC_CFGR_PLLSRC : 0U) |
+                 (hseDividedByTwo ? RCC_CFGR_PLLXTPRE : 0U) | RCC_CFGR_SW_PLL;
+
+        // The USB prescaler divides by 1.5 if the bit is cleared and by 1 if it is set
+        value |= (systemClock == 48'000'000) ? RCC_CFGR_USBPRE : 0U;
+      }
+      else if (source == ClockSource::Hse)
+      {
+        value |= RCC_CFGR_SW_HSE;
+      }
+
+      return value;
+    }
+
+    /// @brief Returns the value of the flash access control register.
+    /// @return Value of FLASH->ACR with the wait states and the prefetch buffer enabled.
+    constexpr uint32_t GetFlashAccessRegister() const
+    {
+      return (flashLatency << FLASH_ACR_LATENCY_Pos) | FLASH_ACR_PRFTBE;
+    }
+  };
+
+  /// @brief Returns the smallest bus divider keeping the bus at or below its maximum frequency.
+  /// @param clock Input clock of the prescaler in Hz.
+  /// @param maximum Maximum bus frequency in Hz.
+  /// @return Divider out of 1, 2, 4, 8 and 16, 0 if none is sufficient.
+  constexpr uint32_t GetBusDivider(const uint32_t clock, const uint32_t maximum)
+  {
+    for (const uint32_t divider : {1U, 2U, 4U, 8U, 16U})
+    {
+      if (clock / divider <= maximum)
+      {
+        return divider;
+      }
+    }
+
+    return 0;
+  }
+
+  /// @brief Computes the clock tree for a system clock.
+  /// @param systemClock Target system clock in Hz.
+  /// @param hseFrequency Frequency of the external crystal in Hz, 0 if there is none.
+  /// @return Clock configuration, `valid` is false if the system clock cannot be generated exactly.
+  /// @details The oscillators are used directly if they match the target, otherwise the PLL multiplies the crystal,
+  ///          the halved crystal or the halved internal oscillator, in this order of preference.
+  constexpr ClockConfig SolveClockConfig(const uint32_t systemClock, const uint32_t hseFrequency = HseFrequency)
+  {
+    ClockConfig config {};
+
+    if (systemClock == 0 || systemClock > MaxSystemClock)
+    {
+      return config;
+    }
+
+    if (hseFrequency != 0 && systemClock == hseFrequency)
+    {
+      config.valid = true;
+      config.source = ClockSource::Hse;
+    }
+    else if (systemClock == HsiFrequency)
+    {
+      config.valid = true;
+      config.source = ClockSource::Hsi;
+    }
+    else if (systemClock >= MinPllClock)
+    {
+      struct PllInput
+      {
+        uint32_t frequency;
+        bool fromHse;
+        bool dividedByTwo;
+      };
+
+      const std::array<PllInput, 3> inputs = {
+        PllInput {.frequency = hseFrequency, .fromHse = true, .dividedByTwo = false},
+        PllInput {.frequency = hseFrequency / 2, .fromHse = true, .dividedByTwo = true},
+        PllInput {.frequency = HsiFrequency / 2, .fromHse = false, .dividedByTwo = false},
+      };
+
+      for (const auto& input : inputs)
+      {
+        if (input.frequency == 0 || systemClock % input.frequency != 0)
+        {
+          continue;
+        }
+
+        const auto multiplier = systemClock / input.frequency;
+
+        if (multiplier >= 2 && multiplier <= 16)
+        {
+          config.valid = true;
+          config.source = ClockSource::Pll;
+          config.pllFromHse = input.fromHse;
+          config.hseDividedByTwo = input.dividedByTwo;
+          config.pllMultiplier = multiplier;
+          break;
+        }
+      }
+    }
+
+    if (!config.valid)
+    {
+      return config;
+    }
+
+    config.systemClock = systemClock;
+    config.ahbClock = systemClock;
+    config.apb1Divider = GetBusDivider(config.ahbClock, MaxApb1Clock);
+    config.apb2Divider = GetBusDivider(config.ahbClock, MaxSystemClock);
+    config.apb1Clock = config.ahbClock / config.apb1Divider;
+    config.apb2Clock = config.ahbClock / config.apb2Divider;
+    config.apb1TimerClock = config.apb1Divider == 1 ? config.apb1Clock : 2 * config.apb1Clock;
+    config.apb2TimerClock = config.apb2Divider == 1 ? config.apb2Clock : 2 * config.apb2Clock;
+
+    for (const uint32_t divider : {2U, 4U, 6U, 8U})
+    {
+      config.adcDivider = divider;
+
+      if (config.apb2Clock / divider <= MaxAdcClock)
+      {
+        break;
+      }
+    }
+
+    config.adcClock = config.apb2Clock / config.adcDivider;
+    config.flashLatency = (systemClock - 1) / FlashClockPerWaitState;
+    config.usbAvailable =
+      config.source == ClockSource::Pll && (systemClock == 48'000'000 || systemClock == 72'000'000);
+
+    return config;
+  }
+
+  /// @brief Returns the clock configuration for a system clock, rejecting unreachable ones at compile time.
+  /// @tparam SystemClock Target system clock in Hz.
+  /// @tparam CrystalFrequency Frequency of the external crystal in Hz.
+  /// @return Clock configuration.
+  template<uint32_t SystemClock, uint32_t CrystalFrequency = HseFrequency>
+  consteval ClockConfig MakeClockConfig()
+  {
+    constexpr auto config = SolveClockConfig(SystemClock, CrystalFrequency);
+    static_assert(config.valid, "The system clock cannot be generated from the oscillators and the PLL");
+    static_assert(config.ahbClock % 1000 == 0, "The SysTick needs a whole number of cycles per millisecond");
+
+    return config;
+  }
+}  // namespace Peripherals::Rcc
+
+#endif  // PERIPHERALS_INC_CLOCKCONFIG_HPP
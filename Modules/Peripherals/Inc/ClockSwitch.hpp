@@ -0,0 +1,131 @@
+/// @file ClockSwitch.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Register sequence switching the system clock between two clock configurations.
+/// @details A switch is split into three steps, so the caller can hand the SysTick timer over to the new clock right
+///          around the source switch. The flash wait states and the bus prescalers are raised before the clock rises
+///          and lowered after it dropped, so the flash and the buses never run faster than allowed. The registers
+///          are accessed through template parameters, so the sequence can be checked against a simulated RCC.
+
+#ifndef PERIPHERALS_INC_CLOCKSWITCH_HPP
+#define PERIPHERALS_INC_CLOCKSWITCH_HPP
+
+#include <stm32f1xx.h>
+
+#include <ClockConfig.hpp>
+#include <cstdint>
+
+namespace Peripherals::Rcc
+{
+  /// @brief Clock configuration after reset, the internal oscillator without prescalers and wait states.
+  constexpr ClockConfig ResetClockConfig = SolveClockConfig(HsiFrequency, 0);
+
+  /// @brief Returns whether a clock configuration needs the external crystal.
+  /// @param config Clock configuration.
+  /// @return True if the crystal drives the system clock directly or through the PLL.
+  constexpr bool UsesHse(const ClockConfig& config)
+  {
+    return config.source == ClockSource::Hse || (config.source == ClockSource::Pll && config.pllFromHse);
+  }
+
+  /// @brief Switches the system clock between two clock configurations.
+  /// @tparam RccRegisters Type of the RCC register block, providing `CR` and `CFGR`.
+  /// @tparam FlashRegisters Type of the flash register block, providing `ACR`.
+  /// @details The PLL can only be reconfigured while it is off, switching between two PLL configurations therefore
+  ///          has to go through one of the oscillators.
+  template<class RccRegisters = RCC_TypeDef, class FlashRegisters = FLASH_TypeDef>
+  class ClockSwitch
+  {
+   private:
+    /// @brief RCC register block.
+    RccRegisters& rcc;
+
+    /// @brief Flash register block.
+    FlashRegisters& flash;
+
+   public:
+    /// @brief Constructor for the ClockSwitch class.
+    /// @param rcc RCC register block.
+    /// @param flash Flash register block.
+    ClockSwitch(RccRegisters& rcc, FlashRegisters& flash) : rcc(rcc), flash(flash)
+    {
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    ClockSwitch(const ClockSwitch&) = delete;
+    ClockSwitch& operator=(const ClockSwitch&) = delete;
+    ClockSwitch(ClockSwitch&&) = delete;
+    ClockSwitch& operator=(ClockSwitch&&) = delete;
+    ~ClockSwitch() = default;
+
+    /// @brief Starts the oscillators of the new configuration and raises the wait states and prescalers.
+    /// @param from Current clock configuration.
+    /// @param to New clock configuration.
+    /// @details Waits until the oscillators are stable, which takes up to a few hundred microseconds for the PLL. The
+    ///          system clock keeps running from the current source meanwhile.
+    void Prepare(const ClockConfig& from, const ClockConfig& to)
+    {
+      if (UsesHse(to))
+      {
+        rcc.CR |= RCC_CR_HSEON;
+        while ((rcc.CR & RCC_CR_HSERDY) == 0)
+        {
+          __NOP();
+        }
+      }
+
+      if (to.systemClock > from.systemClock)
+      {
+        // The wait states and the bus prescalers have to be set before the clock is raised
+        flash.ACR = to.GetFlashAccessRegister();
+        rcc.CFGR = (to.GetConfigurationRegister() & ~RCC_CFGR_SW) | (rcc.CFGR & RCC_CFGR_SW);
+      }
+
+      if (to.source == ClockSource::Pll && from.source != ClockSource::Pll)
+      {
+        rcc.CR |= RCC_CR_PLLON;
+        while ((rcc.CR & RCC_CR_PLLRDY) == 0)
+        {
+          __NOP();
+        }
+      }
+    }
+
+    /// @brief Switches the system clock to the source of the new configuration.
+    /// @param to New clock configuration, prepared before.
+    /// @details Returns as soon as the hardware reports the new source, which takes a few cycles.
+    void Select(const ClockConfig& to)
+    {
+      const auto clockSwitch = to.GetConfigurationRegister() & RCC_CFGR_SW;
+      rcc.CFGR = (rcc.CFGR & ~RCC_CFGR_SW) | clockSwitch;
+
+      while ((rcc.CFGR & RCC_CFGR_SWS) != (clockSwitch << RCC_CFGR_SWS_Pos))
+      {
+        __NOP();
+      }
+    }
+
+    /// @brief Lowers the wait states and prescalers and stops the oscillators no longer needed.
+    /// @param from Previous clock configuration.
+    /// @param to New clock configuration, selected before.
+    void Finish(const ClockConfig& from, const ClockConfig& to)
+    {
+      // The PLL configuration bits may only change while the PLL is off
+      if (from.source == ClockSource::Pll && to.source != ClockSource::Pll)
+      {
+        rcc.CR &= ~RCC_CR_PLLON;
+      }
+
+      if (UsesHse(from) && !UsesHse(to))
+      {
+        rcc.CR &= ~RCC_CR_HSEON;
+      }
+
+      rcc.CFGR = to.GetConfigurationRegister();
+      flash.ACR = to.GetFlashAccessRegister();
+    }
+  };
+}  // namespace Peripherals::Rcc
+
+#endif  // PERIPHERALS_INC_CLOCKSWITCH_HPP
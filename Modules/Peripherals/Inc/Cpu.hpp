@@ -0,0 +1,108 @@
+/// @file Cpu.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Wrappers for the Cortex-M3 core instructions.
+/// @details The peripheral sources are also compiled for the host in the test build. The wrappers map to the CMSIS
+///          intrinsics on the target and compile to nothing on the host, where the instructions do not exist.
+
+#ifndef PERIPHERALS_INC_CPU_HPP
+#define PERIPHERALS_INC_CPU_HPP
+
+#include <stm32f1xx.h>
+
+#include <cstdint>
+
+namespace Peripherals::Cpu
+{
+  /// @brief Suspends execution until an interrupt becomes pending.
+  inline void WaitForInterrupt()
+  {
+#if defined(__arm__)
+    __WFI();
+#endif
+  }
+
+  /// @brief Masks all interrupts with configurable priority.
+  inline void DisableInterrupts()
+  {
+#if defined(__arm__)
+    __disable_irq();
+#endif
+  }
+
+  /// @brief Unmasks all interrupts with configurable priority.
+  inline void EnableInterrupts()
+  {
+#if defined(__arm__)
+    __enable_irq();
+#endif
+  }
+
+  /// @brief Returns the priority mask register.
+  /// @return 1 if all interrupts with configurable priority are masked, 0 otherwise.
+  inline uint32_t GetPrimask()
+  {
+#if defined(__arm__)
+    return __get_PRIMASK();
+#else
+    return 0;
+#endif
+  }
+
+  /// @brief Sets the priority mask register.
+  /// @param primask 1 to mask all interrupts with configurable priority, 0 to unmask them.
+  inline void SetPrimask([[maybe_unused]] const uint32_t primask)
+  {
+#if defined(__arm__)
+    __set_PRIMASK(primask);
+#endif
+  }
+
+  /// @brief Returns the base priority register.
+  /// @return Priority below which interrupts are masked, 0 if none is masked.
+  inline uint32_t GetBasepri()
+  {
+#if defined(__arm__)
+    return __get_BASEPRI();
+#else
+    return 0;
+#endif
+  }
+
+  /// @brief Sets the base priority register.
+  /// @param basepri Priority below which interrupts are masked, 0 to mask none.
+  inline void SetBasepri([[maybe_unused]] const uint32_t basepri)
+  {
+#if defined(__arm__)
+    __set_BASEPRI(basepri);
+#endif
+  }
+
+  /// @brief Sets the base priority register only if it masks more interrupts than before.
+  /// @param basepri Priority below which interrupts are masked.
+  inline void RaiseBasepri([[maybe_unused]] const uint32_t basepri)
+  {
+#if defined(__arm__)
+    __set_BASEPRI_MAX(basepri);
+#endif
+  }
+
+  /// @brief Waits until all outstanding memory accesses are completed.
+  inline void DataSynchronizationBarrier()
+  {
+#if defined(__arm__)
+    __DSB();
+#endif
+  }
+
+  /// @brief Flushes the pipeline, so following instructions are fetched again.
+  inline void InstructionSynchronizationBarrier()
+  {
+#if defined(__arm__)
+    __ISB();
+#endif
+  }
+}  // namespace Peripherals::Cpu
+
+#endif  // PERIPHERALS_INC_CPU_HPP
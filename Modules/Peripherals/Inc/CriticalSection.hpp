@@ -0,0 +1,91 @@
+/// @file CriticalSection.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Guards masking interrupts for the lifetime of a scope.
+/// @details A `PrimaskLock` masks every interrupt with configurable priority, it is needed where nothing may run in
+///          between, e.g. before entering a low power mode. A `BasepriLock` only masks the interrupts at or below a
+///          preemption priority, so the interrupts above it keep their latency while the data shared with the masked
+///          ones is accessed. Both guards restore the previous mask, so they nest and work inside interrupt handlers.
+
+#ifndef PERIPHERALS_INC_CRITICALSECTION_HPP
+#define PERIPHERALS_INC_CRITICALSECTION_HPP
+
+#include <Cpu.hpp>
+#include <NvicPriorities.hpp>
+#include <cstdint>
+
+namespace Peripherals
+{
+  /// @brief Masks all interrupts with configurable priority for the lifetime of the guard.
+  class PrimaskLock
+  {
+   private:
+    /// @brief Priority mask before the guard was created.
+    uint32_t primask;
+
+   public:
+    /// @brief Constructor for the PrimaskLock class, masks the interrupts.
+    PrimaskLock() : primask(Cpu::GetPrimask())
+    {
+      Cpu::DisableInterrupts();
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    PrimaskLock(const PrimaskLock&) = delete;
+    PrimaskLock& operator=(const PrimaskLock&) = delete;
+    PrimaskLock(PrimaskLock&&) = delete;
+    PrimaskLock& operator=(PrimaskLock&&) = delete;
+
+    /// @brief Destructor for the PrimaskLock class, restores the previous mask.
+    ~PrimaskLock()
+    {
+      Cpu::SetPrimask(primask);
+    }
+  };
+
+  /// @brief Masks the interrupts at or below a preemption priority for the lifetime of the guard.
+  /// @tparam Level Highest masked preemption priority, the interrupts with a lower number stay enabled.
+  /// @details The base priority is only raised, so a guard inside a handler or another guard never unmasks anything.
+  template<uint32_t Level>
+  class BasepriLock
+  {
+   private:
+    static_assert(Level > 0, "Preemption priority 0 cannot be masked by the base priority, use a PrimaskLock");
+    static_assert(Level < Nvic::PreemptLevels, "The level exceeds the preemption priorities of the grouping");
+
+    /// @brief Base priority before the guard was created.
+    uint32_t basepri;
+
+   public:
+    /// @brief Value of the base priority register while the guard exists.
+    static constexpr uint32_t Value = Nvic::ToBasepri(Level);
+
+    /// @brief Constructor for the BasepriLock class, masks the interrupts.
+    BasepriLock() : basepri(Cpu::GetBasepri())
+    {
+      Cpu::RaiseBasepri(Value);
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    BasepriLock(const BasepriLock&) = delete;
+    BasepriLock& operator=(const BasepriLock&) = delete;
+    BasepriLock(BasepriLock&&) = delete;
+    BasepriLock& operator=(BasepriLock&&) = delete;
+
+    /// @brief Destructor for the BasepriLock class, restores the previous mask.
+    ~BasepriLock()
+    {
+      Cpu::SetBasepri(basepri);
+    }
+  };
+
+  /// @brief Preemption priority of the highest interrupt calling the kernel or the timer service, the SysTick.
+  /// @details Interrupts with a higher priority are never masked by the kernel and may not call it.
+  constexpr uint32_t KernelPriority = 1;
+
+  /// @brief Guard of the data shared by the kernel and the timer service with the interrupt handlers.
+  using KernelLock = BasepriLock<KernelPriority>;
+}  // namespace Peripherals
+
+#endif  // PERIPHERALS_INC_CRITICALSECTION_HPP
@@ -0,0 +1,66 @@
+/// @file Dwt.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Cycle counter of the data watchpoint and trace unit.
+/// @details The counter runs with the core clock and wraps around after about 60 s at 72 MHz, differences of two
+///          readings are therefore valid as long as the measured section is shorter.
+
+#ifndef PERIPHERALS_INC_DWT_HPP
+#define PERIPHERALS_INC_DWT_HPP
+
+#include <stm32f1xx.h>
+
+#include <cstdint>
+
+namespace Peripherals::Dwt
+{
+  /// @brief Cycle counter of the data watchpoint and trace unit.
+  class CycleCounter
+  {
+   public:
+    // Delete not needed constructors and destructors
+    CycleCounter() = delete;
+    CycleCounter(const CycleCounter&) = delete;
+    CycleCounter& operator=(const CycleCounter&) = delete;
+    CycleCounter(CycleCounter&&) = delete;
+    CycleCounter& operator=(CycleCounter&&) = delete;
+    ~CycleCounter() = delete;
+
+    /// @brief Enables the trace unit and starts the cycle counter from zero, unless it is running already.
+    /// @details The reset handler starts the counter for the boot profiler, the counts since reset are kept.
+    static void Enable()
+    {
+#if defined(__arm__)
+      if ((CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) == 0 || (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0)
+      {
+        Restart();
+      }
+#endif
+    }
+
+    /// @brief Enables the trace unit and restarts the cycle counter from zero.
+    /// @details A debugger may leave the counter running across a reset, so the reset handler restarts it.
+    static void Restart()
+    {
+#if defined(__arm__)
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CYCCNT = 0;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    }
+
+    /// @brief Returns the current value of the cycle counter.
+    /// @return Core clock cycles since the counter was enabled, 0 on the host.
+    static uint32_t Now()
+    {
+#if defined(__arm__)
+      return DWT->CYCCNT;
+#else
+      return 0;
+#endif
+    }
+  };
+}  // namespace Peripherals::Dwt
+
+#endif  // PERIPHERALS_INC_DWT_HPP
@@ -2,14 +2,21 @@
 /// @author Dennis Stumm
 /// @date 2025
 /// @version 1.0
-/// @brief
+/// @brief Configures the external interrupt lines 0-15 and dispatches their interrupts to registered handlers.
+/// @details Each line is connected to the pin of the same number of one port, selected in the AFIO external interrupt
+///          configuration registers. The lines 5-9 and 10-15 share an interrupt each, the shared handlers find the
+///          pending lines with a count leading zeros instruction, so dispatching costs the same for any number of
+///          registered handlers.
 
 #ifndef PERIPHERALS_INC_EXTI_HPP
 #define PERIPHERALS_INC_EXTI_HPP
 
 #include <stm32f1xx.h>
+
 #include <array>
-#include <cstdio>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
 
 namespace Peripherals::Exti
 {
@@ -24,15 +31,129 @@ namespace Peripherals::Exti
     PortG = 6,
   };
 
-  class ExternalInterruptManager
+  /// @brief Edges of a pin triggering the interrupt of its line.
+  enum class Edge : uint8_t
+  {
+    Rising = 1,
+    Falling = 2,
+    Both = 3,
+  };
+
+  /// @brief Number of the lines connected to the GPIO pins.
+  constexpr uint32_t LineCount = 16;
+
+  /// @brief Lines of the interrupt shared by the lines 5-9.
+  constexpr uint32_t Lines9To5 = 0x03E0U;
+
+  /// @brief Lines of the interrupt shared by the lines 10-15.
+  constexpr uint32_t Lines15To10 = 0xFC00U;
+
+  /// @brief Handler of a line, called with the context given at registration and the number of the line.
+  using LineCallback = void (*)(void* context, uint32_t line);
+
+  /// @brief Handler registered for a line.
+  struct LineHandler
+  {
+    /// @brief Function called on an edge of the line, nullptr if the line has no handler.
+    LineCallback callback = nullptr;
+
+    /// @brief Context passed to the callback.
+    void* context = nullptr;
+  };
+
+  /// @brief Handler bound to a line, used to build a table at compile time.
+  struct LineBinding
+  {
+    /// @brief Number of the line (0-15).
+    uint32_t line;
+
+    /// @brief Handler of the line.
+    LineHandler handler;
+  };
+
+  /// @brief Handlers of the lines 0-15, indexed by the line.
+  class LineTable
   {
    private:
-    static constexpr int interruptHandlerAmount = 1;
-    static constexpr std::array<void (*)(), interruptHandlerAmount> exti0interruptHandlers = {
-      []() {
-        printf("Hello World!\n");
+    /// @brief Handlers of the lines.
+    std::array<LineHandler, LineCount> handlers {};
+
+   public:
+    /// @brief Constructor for an empty table.
+    constexpr LineTable() = default;
+
+    /// @brief Constructor for a table built at compile time.
+    /// @param bindings Handlers of the lines, a line given twice takes the last handler.
+    constexpr LineTable(const std::initializer_list<LineBinding> bindings)
+    {
+      for (const auto& binding : bindings)
+      {
+        Attach(binding.line, binding.handler.callback, binding.handler.context);
       }
-    };
+    }
+
+    /// @brief Registers the handler of a line, replacing the previous one.
+    /// @param line Number of the line (0-15).
+    /// @param callback Function called on an edge of the line.
+    /// @param context Context passed to the callback.
+    constexpr void Attach(const uint32_t line, const LineCallback callback, void* context)
+    {
+      handlers[line] = LineHandler {
+        .callback = callback,
+        .context = context,
+      };
+    }
+
+    /// @brief Removes the handler of a line, its edges are cleared without being handled.
+    /// @param line Number of the line (0-15).
+    constexpr void Detach(const uint32_t line)
+    {
+      handlers[line] = LineHandler {};
+    }
+
+    /// @brief Returns whether a line has a handler.
+    /// @param line Number of the line (0-15).
+    /// @return True if a handler is registered.
+    constexpr bool IsAttached(const uint32_t line) const
+    {
+      return handlers[line].callback != nullptr;
+    }
+
+    /// @brief Clears the pending lines of an interrupt and calls their handlers.
+    /// @tparam Registers Register block of the EXTI, replaced by a simulation in the tests.
+    /// @param exti Registers of the EXTI.
+    /// @param lines Lines served by the interrupt.
+    /// @return Lines which were pending.
+    /// @details The pending lines are cleared with a single write before the handlers run, so an edge during a
+    ///          handler pends the interrupt again. The highest pending line is found with one count leading zeros
+    ///          instruction, the loop runs once per pending line and not once per registered handler.
+    template<typename Registers>
+    uint32_t Dispatch(Registers& exti, const uint32_t lines) const
+    {
+      constexpr uint32_t highestBit = 31;
+      const uint32_t pending = exti.PR & exti.IMR & lines;
+      exti.PR = pending;
+
+      for (auto remaining = pending; remaining != 0;)
+      {
+        const auto line = highestBit - static_cast<uint32_t>(std::countl_zero(remaining));
+        remaining &= ~(1U << line);
+
+        if (const auto& handler = handlers[line]; handler.callback != nullptr)
+        {
+          handler.callback(handler.context, line);
+        }
+      }
+
+      return pending;
+    }
+  };
+
+  class ExternalInterruptManager
+  {
+   private:
+    /// @brief Handlers of the lines, registered at runtime or installed from a table built at compile time.
+    static inline constinit LineTable table {};
 
    public:
     // Deleted copy constructor and assignment operator.
@@ -43,40 +164,76 @@ namespace Peripherals::Exti
     ExternalInterruptManager& operator=(ExternalInterruptManager&&) = delete;
     ~ExternalInterruptManager() = delete;
 
-    static void SetupExti0Interrupt(ExtiPort port)
+    /// @brief Connects a line to a pin and unmasks its interrupt.
+    /// @param line Number of the line, which is the number of the pin (0-15).
+    /// @param port Port of the pin, each line can be connected to one port only.
+    /// @param edge Edges of the pin triggering the interrupt.
+    /// @details A pending edge from before the configuration is cleared. The NVIC interrupts of the lines are enabled
+    ///          by the `InterruptManager`.
+    static void Configure(const uint32_t line, const ExtiPort port, const Edge edge)
     {
+      constexpr uint32_t linesPerRegister = 4;
+      constexpr uint32_t fieldWidth = 4;
+      constexpr uint32_t fieldMask = 0xFU;
+      const auto shift = (line % linesPerRegister) * fieldWidth;
+      const auto lineMask = 1U << line;
+      const auto edges = static_cast<uint32_t>(edge);
+
       RCC->APB2ENR |= RCC_APB2ENR_AFIOEN;
-      AFIO->EXTICR[0] &= ~AFIO_EXTICR1_EXTI0;
-      AFIO->EXTICR[0] |= static_cast<uint32_t>(port) << AFIO_EXTICR1_EXTI0_Pos;
-      EXTI->IMR |= EXTI_IMR_MR0;
-      EXTI->RTSR |= EXTI_RTSR_TR0;  // Trigger on rising edge
-      EXTI->FTSR &= ~EXTI_FTSR_TR0; // Disable falling
+      AFIO->EXTICR[line / linesPerRegister] =
+        (AFIO->EXTICR[line / linesPerRegister] & ~(fieldMask << shift)) | (static_cast<uint32_t>(port) << shift);
+
+      EXTI->RTSR = ((edges & static_cast<uint32_t>(Edge::Rising)) != 0) ? (EXTI->RTSR | lineMask)
+                                                                         : (EXTI->RTSR & ~lineMask);
+      EXTI->FTSR = ((edges & static_cast<uint32_t>(Edge::Falling)) != 0) ? (EXTI->FTSR | lineMask)
+                                                                          : (EXTI->FTSR & ~lineMask);
+      EXTI->PR = lineMask;
+      EXTI->IMR |= lineMask;
     }
 
-    static constexpr void HandleExti0Interrupt()
+    /// @brief Masks the interrupt of a line.
+    /// @param line Number of the line (0-15).
+    static void Disable(const uint32_t line)
     {
-      // Clear the pending interrupt for EXTI0
-      NVIC_ClearPendingIRQ(EXTI0_IRQn);
+      EXTI->IMR &= ~(1U << line);
+    }
 
-      ExecuteExti0InterruptHandler<interruptHandlerAmount - 1>();
+    /// @brief Registers the handler of a line, replacing the previous one.
+    /// @param line Number of the line (0-15).
+    /// @param callback Function called in the interrupt of the line.
+    /// @param context Context passed to the callback.
+    /// @details The interrupt of the line has to be masked or the callback and the context may be seen torn.
+    static void Attach(const uint32_t line, const LineCallback callback, void* context)
+    {
+      table.Attach(line, callback, context);
     }
 
-    template<int N>
-    static constexpr void ExecuteExti0InterruptHandler()
+    /// @brief Installs the handlers of a table built at compile time, replacing all registered handlers.
+    /// @param handlers Table of the handlers.
+    static void Install(const LineTable& handlers)
     {
-      if constexpr (N < interruptHandlerAmount)
-      {
-        if constexpr (exti0interruptHandlers[N] != 0)
-        {
-          exti0interruptHandlers[N]();
-        }
-      }
+      table = handlers;
+    }
 
-      if constexpr (N > 0)
-      {
-        // Recursively call the next handler
-        ExecuteExti0InterruptHandler<N - 1>();
-      }
+    /// @brief Handles the interrupt of a single line 0-4.
+    /// @tparam Line Number of the line.
+    template<uint32_t Line>
+    static void HandleInterrupt()
+    {
+      static_assert(Line < 5, "The lines 5-15 share their interrupts");
+      table.Dispatch(*EXTI, 1U << Line);
+    }
+
+    /// @brief Handles the interrupt shared by the lines 5-9.
+    static void HandleExti9_5Interrupt()
+    {
+      table.Dispatch(*EXTI, Lines9To5);
+    }
+
+    /// @brief Handles the interrupt shared by the lines 10-15.
+    static void HandleExti15_10Interrupt()
+    {
+      table.Dispatch(*EXTI, Lines15To10);
     }
   };
 }  // namespace Peripherals::Exti
@@ -56,8 +56,20 @@ namespace Peripherals::Gpio
     size_t afioMode;
   };
 
+  /// @brief Enables the clock of a GPIO port and configures the mode and type of one of its pins.
+  /// @param port Pointer to the GPIO port (e.g., GPIOA, GPIOB, etc.).
+  /// @param pin The pin number within the GPIO port (0-15).
+  /// @param mode The mode of the GPIO pin (e.g., Input, OutputLow, etc.).
+  /// @param ioType The input/output type of the GPIO pin (e.g., AnalogMode_PushPull, Floating_OpenDrain, etc.).
+  void ConfigurePin(GPIO_TypeDef* port, size_t pin, Mode mode, InputOutputType ioType);
+
+  /// @brief Enables the AFIO clock and applies a remap configuration.
+  /// @param afioConfig The AFIO configuration.
+  void ConfigureAfio(const AfioConfig& afioConfig);
+
   /// @brief Class representing a General Purpose Input Output (GPIO) pin.
-  /// @details This class provides methods to configure and control GPIO pins on STM32 microcontrollers.
+  /// @details This class provides methods to configure and control GPIO pins on STM32 microcontrollers. The port and
+  ///          pin are chosen at runtime, pins known at compile time are better served by `Pin`.
   class Gpio
   {
    private:
@@ -70,20 +82,6 @@ namespace Peripherals::Gpio
     /// @brief Bitmask for the pin within the GPIO port.
     const uint32_t pinMask;
 
-    /// @brief Amount of pins in the low configuration register.
-    constexpr static uint32_t LOW_PIN_COUNT = 8U;
-
-    /// @brief Bitmask and shift values for configuring GPIO pins.
-    constexpr static uint32_t PIN_CONFIG_MASK = 0xFU;
-
-    /// @brief Shift multiplier for the mode bits in the GPIO configuration.
-    /// @details The mode bits are shifted by 4 bits for each pin in the configuration registers.
-    constexpr static uint32_t MODE_SHIFT_MULTIPLIER = 4U;
-
-    /// @brief Additional shift for the configuration bits in the GPIO configuration.
-    /// @details This is used to shift the configuration bits in the GPIO register.
-    constexpr static uint32_t CONFIG_SHIFT_ADDITION = 2U;
-
    public:
     // Deleted copy constructor and assignment operator.
     Gpio(const Gpio&) = delete;
@@ -114,7 +112,8 @@ namespace Peripherals::Gpio
     /// @brief Sets the state of the GPIO pin.
     /// @param state The desired state of the GPIO pin (true for high, false for low).
     /// @details This method sets the output state of the GPIO pin. If the pin is configured as an input, this method
-    ///          has no effect.
+    ///          has no effect. The bit set/reset register changes the pin with a single store, so an interrupt
+    ///          changing another pin of the port meanwhile is not overwritten.
     void SetState(const bool state) const;
 
     /// @brief Toggles the state of the GPIO pin.
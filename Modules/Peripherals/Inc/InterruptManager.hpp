@@ -9,14 +9,87 @@
 
 #include <stm32f1xx.h>
 
+#include <CriticalSection.hpp>
+#include <NvicPriorities.hpp>
+#include <VectorTable.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstdlib>
 
 namespace Peripherals
 {
+  /// @brief Interrupt entry latencies measured by `InterruptManager::MeasureEntryLatency()`.
+  struct EntryLatency
+  {
+    /// @brief Cycles from pending the probe interrupt until its handler runs, with the vector table in flash.
+    uint32_t flash;
+
+    /// @brief Cycles from pending the probe interrupt until its handler runs, with the vector table in RAM.
+    uint32_t ram;
+  };
+
   /// @brief Interrupt manager to configure the interrupts.
   class InterruptManager
   {
    public:
+    /// @brief Interrupts enabled by `SetupNvicPriorities()`, each needs a vector and each vector needs its interrupt.
+    static constexpr std::array<IRQn_Type, 13> EnabledInterrupts = {
+      // The EXTI interrupts only fire for lines configured by the EXTI driver
+      IRQn_Type::EXTI0_IRQn,
+      IRQn_Type::EXTI1_IRQn,
+      IRQn_Type::EXTI2_IRQn,
+      IRQn_Type::EXTI3_IRQn,
+      IRQn_Type::EXTI4_IRQn,
+      IRQn_Type::EXTI9_5_IRQn,
+      IRQn_Type::EXTI15_10_IRQn,
+      IRQn_Type::USART1_IRQn,
+
+      // The timer interrupts only fire for channels started by the timer driver
+      IRQn_Type::TIM2_IRQn,
+      IRQn_Type::TIM3_IRQn,
+      IRQn_Type::TIM4_IRQn,
+
+      // The RTC interrupts only fire for callbacks registered with the RTC driver
+      IRQn_Type::RTC_IRQn,
+
+      // The alarm line of the EXTI wakes the core from Stop mode, its handler only clears the line
+      IRQn_Type::RTC_Alarm_IRQn,
+    };
+
+    /// @brief Interrupt pended by software to measure the entry latency, the tamper pin is not used.
+    static constexpr IRQn_Type LatencyProbeInterrupt = IRQn_Type::TAMPER_IRQn;
+
+    /// @brief Preemption and sub priorities of the used exceptions and interrupts.
+    static constexpr std::array<Nvic::InterruptPriority, 16> Priorities = {{
+      // Compare events and captures of the hardware timers are timing critical, they are above the kernel and are
+      // never masked by its critical sections, so they may not call the kernel or the timer service
+      {IRQn_Type::TIM2_IRQn, 0, 0},
+      {IRQn_Type::TIM3_IRQn, 0, 0},
+      {IRQn_Type::TIM4_IRQn, 0, 0},
+      {LatencyProbeInterrupt, 0, 1},
+
+      // The tick drives the kernel and the timer service, their critical sections mask it and everything below
+      {IRQn_Type::SysTick_IRQn, KernelPriority, 0},
+
+      // The edges of the watched inputs only start the sampling timer, a received byte waits behind them
+      {IRQn_Type::EXTI0_IRQn, 2, 0},
+      {IRQn_Type::EXTI1_IRQn, 2, 0},
+      {IRQn_Type::EXTI2_IRQn, 2, 0},
+      {IRQn_Type::EXTI3_IRQn, 2, 0},
+      {IRQn_Type::EXTI4_IRQn, 2, 0},
+      {IRQn_Type::EXTI9_5_IRQn, 2, 0},
+      {IRQn_Type::EXTI15_10_IRQn, 2, 0},
+      {IRQn_Type::USART1_IRQn, 2, 1},
+
+      // The seconds and the alarm only set events, a late callback does not change the time
+      {IRQn_Type::RTC_IRQn, 3, 0},
+      {IRQn_Type::RTC_Alarm_IRQn, 3, 0},
+
+      // The context switch must not interrupt any other handler, so PendSV has the lowest priority
+      {IRQn_Type::PendSV_IRQn, Nvic::PreemptLevels - 1, Nvic::SubLevels - 1},
+    }};
+
     // Delete not needed constructors and destructors
     constexpr InterruptManager() = delete;
     InterruptManager(const InterruptManager&) = delete;
@@ -25,15 +98,52 @@ namespace Peripherals
     InterruptManager& operator=(InterruptManager&&) = delete;
     virtual ~InterruptManager() = delete;
 
-    /// @brief Configures the NVIC priorities for the used interrupts.
+    /// @brief Sets the priority grouping and the priorities, then enables the interrupts.
     static void SetupNvicPriorities()
     {
-      NVIC_SetPriority(IRQn_Type::SysTick_IRQn, 0);
-      NVIC_SetPriority(IRQn_Type::EXTI0_IRQn, 5);
+      Nvic::Apply(Priorities);
+
+      for (const auto irq : EnabledInterrupts)
+      {
+        NVIC_EnableIRQ(irq);
+      }
+    }
+
+    /// @brief Copies the vectors of the application into RAM and activates them.
+    /// @details Called first in main, before any interrupt is enabled.
+    static void RelocateVectorTable();
 
-      NVIC_EnableIRQ(IRQn_Type::EXTI0_IRQn);
+    /// @brief Replaces the handler of an exception or interrupt at runtime.
+    /// @param irq Number of the exception or interrupt.
+    /// @param handler New handler.
+    static void SetHandler(const IRQn_Type irq, const Vectors::Handler handler)
+    {
+      Vectors::ramVectorTable.Set(irq, handler);
     }
+
+    /// @brief Measures the entry latency of an interrupt with the vector table in flash and in RAM.
+    /// @return Shortest latencies of several measurements in core clock cycles, 0 on the host.
+    /// @details Pends the probe interrupt at the highest priority and reads the cycle counter first thing in its
+    ///          handler. The flash table of the startup file is active during its measurement, its vectors point to the
+    ///          same handlers.
+    static EntryLatency MeasureEntryLatency();
   };
+
+  static_assert(!Nvic::HasDuplicates(InterruptManager::Priorities), "An interrupt has more than one priority");
+  static_assert(Nvic::IsWithinGroupLimits(InterruptManager::Priorities),
+                "A priority exceeds the bits of the priority grouping");
+  static_assert(std::ranges::all_of(InterruptManager::EnabledInterrupts,
+                                    [](const IRQn_Type irq) {
+                                      return Nvic::GetPreempt(InterruptManager::Priorities, irq) < Nvic::PreemptLevels;
+                                    }),
+                "Each enabled interrupt needs a priority");
+  static_assert(std::ranges::all_of(InterruptManager::Priorities,
+                                    [](const Nvic::InterruptPriority& priority) {
+                                      return (priority.irq == IRQn_Type::PendSV_IRQn) ||
+                                             (Nvic::Encode(priority) < Nvic::Encode(InterruptManager::Priorities.back()));
+                                    }),
+                "PendSV has to have the lowest priority");
+  static_assert(InterruptManager::Priorities.back().irq == IRQn_Type::PendSV_IRQn, "PendSV is the last entry");
 }  // namespace Peripherals
 
 #endif
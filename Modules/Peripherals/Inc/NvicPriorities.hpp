@@ -0,0 +1,133 @@
+/// @file NvicPriorities.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Priority grouping of the NVIC and compile time priority tables.
+/// @details The STM32F1 implements the upper four bits of each priority. Three of them are the preemption priority,
+///          which decides whether an interrupt preempts a running handler. The fourth is the sub priority, which only
+///          orders pending interrupts of the same preemption priority. A table maps each interrupt to both, it is
+///          validated at compile time and applied with one write per interrupt.
+
+#ifndef PERIPHERALS_INC_NVICPRIORITIES_HPP
+#define PERIPHERALS_INC_NVICPRIORITIES_HPP
+
+#include <stm32f1xx.h>
+
+#include <cstdint>
+#include <span>
+
+namespace Peripherals::Nvic
+{
+  /// @brief Number of the implemented priority bits.
+  constexpr uint32_t PriorityBits = __NVIC_PRIO_BITS;
+
+  /// @brief Number of the bits of the preemption priority.
+  constexpr uint32_t PreemptBits = 3;
+
+  /// @brief Number of the bits of the sub priority.
+  constexpr uint32_t SubBits = PriorityBits - PreemptBits;
+
+  /// @brief Number of the preemption priorities, 0 is the highest.
+  constexpr uint32_t PreemptLevels = 1U << PreemptBits;
+
+  /// @brief Number of the sub priorities, 0 is the highest.
+  constexpr uint32_t SubLevels = 1U << SubBits;
+
+  /// @brief Value of the priority grouping field of the AIRCR, the bits below the binary point are the sub priority.
+  constexpr uint32_t PriorityGrouping = (8 - PriorityBits) + SubBits - 1;
+
+  /// @brief Priority of an interrupt or exception.
+  struct InterruptPriority
+  {
+    /// @brief Number of the interrupt or exception.
+    IRQn_Type irq;
+
+    /// @brief Preemption priority, 0 is the highest.
+    uint8_t preempt;
+
+    /// @brief Sub priority, 0 is the highest.
+    uint8_t sub;
+  };
+
+  /// @brief Encodes a priority for `NVIC_SetPriority()`, like `NVIC_EncodePriority()` for the priority grouping.
+  /// @param priority Priority of the interrupt.
+  /// @return Priority value with the implemented bits in the lower bits.
+  constexpr uint32_t Encode(const InterruptPriority& priority)
+  {
+    return (static_cast<uint32_t>(priority.preempt) << SubBits) | priority.sub;
+  }
+
+  /// @brief Returns the value of the base priority register masking a preemption priority and all lower ones.
+  /// @param preempt Preemption priority.
+  /// @return Value of the BASEPRI register.
+  constexpr uint32_t ToBasepri(const uint32_t preempt)
+  {
+    return (preempt << SubBits) << (8 - PriorityBits);
+  }
+
+  /// @brief Returns whether all priorities of a table fit into the priority grouping.
+  /// @param priorities Priorities of the interrupts.
+  /// @return True if no preemption or sub priority exceeds its number of bits.
+  constexpr bool IsWithinGroupLimits(const std::span<const InterruptPriority> priorities)
+  {
+    for (const auto& priority : priorities)
+    {
+      if (priority.preempt >= PreemptLevels || priority.sub >= SubLevels)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief Returns whether an interrupt appears twice in a table.
+  /// @param priorities Priorities of the interrupts.
+  /// @return True if an interrupt has more than one priority.
+  constexpr bool HasDuplicates(const std::span<const InterruptPriority> priorities)
+  {
+    for (std::size_t first = 0; first < priorities.size(); ++first)
+    {
+      for (std::size_t second = first + 1; second < priorities.size(); ++second)
+      {
+        if (priorities[first].irq == priorities[second].irq)
+        {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  /// @brief Returns the preemption priority of an interrupt in a table.
+  /// @param priorities Priorities of the interrupts.
+  /// @param irq Number of the interrupt or exception.
+  /// @return Preemption priority, `PreemptLevels` if the interrupt is not in the table.
+  constexpr uint32_t GetPreempt(const std::span<const InterruptPriority> priorities, const IRQn_Type irq)
+  {
+    for (const auto& priority : priorities)
+    {
+      if (priority.irq == irq)
+      {
+        return priority.preempt;
+      }
+    }
+
+    return PreemptLevels;
+  }
+
+  /// @brief Sets the priority grouping and the priorities of a table.
+  /// @param priorities Priorities of the interrupts.
+  inline void Apply(const std::span<const InterruptPriority> priorities)
+  {
+    NVIC_SetPriorityGrouping(PriorityGrouping);
+
+    for (const auto& priority : priorities)
+    {
+      NVIC_SetPriority(priority.irq, Encode(priority));
+    }
+  }
+}  // namespace Peripherals::Nvic
+
+#endif  // PERIPHERALS_INC_NVICPRIORITIES_HPP
@@ -0,0 +1,106 @@
+/// @file Pin.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief General purpose input output (GPIO) pin known at compile time.
+/// @details The port and the pin number are template parameters, so the register addresses and the mask are constants
+///          and the class holds no data. Setting or clearing the pin compiles to a single store into the bit
+///          set/reset register, reading it to a single load from the input data register. The stores only affect
+///          the written pin, so they need no lock against interrupts changing other pins of the same port.
+
+#ifndef PERIPHERALS_INC_PIN_HPP
+#define PERIPHERALS_INC_PIN_HPP
+
+#include <stm32f1xx.h>
+
+#include <Gpio.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace Peripherals::Gpio
+{
+  /// @brief Class representing a GPIO pin whose port and number are known at compile time.
+  /// @tparam PortBase Base address of the GPIO port (e.g., GPIOB_BASE).
+  /// @tparam Number The pin number within the GPIO port (0-15).
+  template<uintptr_t PortBase, size_t Number>
+  class Pin
+  {
+   private:
+    static_assert(Number < 16, "A GPIO port has 16 pins");
+
+    /// @brief Offset of the reset bits in the bit set/reset register.
+    static constexpr uint32_t ResetShift = 16U;
+
+    /// @brief Returns the GPIO port.
+    /// @return Pointer to the GPIO port registers.
+    static GPIO_TypeDef* GetPort()
+    {
+      return reinterpret_cast<GPIO_TypeDef*>(PortBase);
+    }
+
+   public:
+    /// @brief Bitmask for the pin within the GPIO port.
+    static constexpr uint32_t Mask = 1U << Number;
+
+    // Deleted copy and move constructors and assignment operators.
+    Pin(const Pin&) = delete;
+    Pin& operator=(const Pin&) = delete;
+    Pin(Pin&&) = delete;
+    Pin& operator=(Pin&&) = delete;
+    ~Pin() = default;
+
+    /// @brief Constructor for the Pin class.
+    /// @param mode The mode of the GPIO pin (e.g., Input, OutputLow, etc.).
+    /// @param ioType The input/output type of the GPIO pin (e.g., AnalogMode_PushPull, Floating_OpenDrain, etc.).
+    Pin(const Mode mode, const InputOutputType ioType)
+    {
+      ConfigurePin(GetPort(), Number, mode, ioType);
+    }
+
+    /// @brief Constructor for the Pin class with AFIO configuration.
+    /// @param mode The mode of the GPIO pin (e.g., Input, OutputLow, etc.).
+    /// @param ioType The input/output type of the GPIO pin (e.g., AnalogMode_PushPull, Floating_OpenDrain, etc.).
+    /// @param afioConfig The AFIO configuration for the GPIO pin.
+    Pin(const Mode mode, const InputOutputType ioType, const AfioConfig& afioConfig) : Pin(mode, ioType)
+    {
+      ConfigureAfio(afioConfig);
+    }
+
+    /// @brief Drives the pin high.
+    static void Set()
+    {
+      GetPort()->BSRR = Mask;
+    }
+
+    /// @brief Drives the pin low.
+    static void Clear()
+    {
+      GetPort()->BRR = Mask;
+    }
+
+    /// @brief Sets the state of the pin.
+    /// @param state The desired state of the pin (true for high, false for low).
+    /// @details The set and the reset bits share one register, so both states are a single store.
+    static void SetState(const bool state)
+    {
+      GetPort()->BSRR = state ? Mask : (Mask << ResetShift);
+    }
+
+    /// @brief Toggles the state of the pin.
+    /// @details Reads the output data register and writes the opposite state, other pins of the port are not
+    ///          written.
+    static void ToggleState()
+    {
+      SetState((GetPort()->ODR & Mask) == 0);
+    }
+
+    /// @brief Gets the current state of the pin.
+    /// @return The current state of the pin (true for high, false for low).
+    static bool GetState()
+    {
+      return (GetPort()->IDR & Mask) != 0;
+    }
+  };
+}  // namespace Peripherals::Gpio
+
+#endif
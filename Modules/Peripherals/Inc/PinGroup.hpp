@@ -0,0 +1,283 @@
+/// @file PinGroup.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Configures and writes several pins of a GPIO port together.
+/// @details Each pin owns four bits of the configuration registers, so configuring pins one by one reads and writes
+///          the same register once per pin. `PortConfiguration` merges the fields of all pins, which are then
+///          applied with one write per configuration register. Any mask of pins is set and cleared with one store
+///          into the bit set/reset register, whose upper half clears the pins of the lower half.
+
+#ifndef PERIPHERALS_INC_PINGROUP_HPP
+#define PERIPHERALS_INC_PINGROUP_HPP
+
+#include <stm32f1xx.h>
+
+#include <Gpio.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace Peripherals::Gpio
+{
+  /// @brief Configuration of a single pin within a port.
+  struct PinConfig
+  {
+    /// @brief The pin number within the GPIO port (0-15).
+    size_t number;
+
+    /// @brief The mode of the GPIO pin.
+    Mode mode;
+
+    /// @brief The input/output type of the GPIO pin.
+    InputOutputType ioType;
+  };
+
+  /// @brief Returns the APB2 clock enable bit of a GPIO port.
+  /// @param portBase Base address of the GPIO port.
+  /// @return Clock enable bit, 0 if the address is none of the ports A to E.
+  constexpr uint32_t GetClockEnableMask(const uintptr_t portBase)
+  {
+    constexpr uintptr_t portStride = GPIOB_BASE - GPIOA_BASE;
+
+    if (portBase < GPIOA_BASE || portBase > GPIOE_BASE || ((portBase - GPIOA_BASE) % portStride) != 0)
+    {
+      return 0;
+    }
+
+    return RCC_APB2ENR_IOPAEN << ((portBase - GPIOA_BASE) / portStride);
+  }
+
+  /// @brief Merged configuration register fields of several pins of one port.
+  class PortConfiguration
+  {
+   private:
+    /// @brief Amount of pins in the low configuration register.
+    static constexpr size_t LowPinCount = 8;
+
+    /// @brief Width of the field of a pin in the configuration registers.
+    static constexpr uint32_t FieldWidth = 4;
+
+    /// @brief Mask of the field of a pin.
+    static constexpr uint32_t FieldMask = 0xFU;
+
+    /// @brief Shift of the input/output type within the field of a pin.
+    static constexpr uint32_t TypeShift = 2;
+
+    /// @brief Fields of the pins 0-7 in the low configuration register.
+    uint32_t lowMask = 0;
+
+    /// @brief Values of the fields in the low configuration register.
+    uint32_t lowValue = 0;
+
+    /// @brief Fields of the pins 8-15 in the high configuration register.
+    uint32_t highMask = 0;
+
+    /// @brief Values of the fields in the high configuration register.
+    uint32_t highValue = 0;
+
+   public:
+    /// @brief Constructor for an empty configuration.
+    constexpr PortConfiguration() = default;
+
+    /// @brief Constructor for the PortConfiguration class.
+    /// @param pins Configurations of the pins, a pin given twice takes the last configuration.
+    constexpr PortConfiguration(const std::initializer_list<PinConfig> pins)
+    {
+      for (const auto& pin : pins)
+      {
+        Add(pin);
+      }
+    }
+
+    /// @brief Adds a pin to the configuration.
+    /// @param pin Configuration of the pin.
+    /// @return Reference to this configuration.
+    constexpr PortConfiguration& Add(const PinConfig& pin)
+    {
+      const auto shift = static_cast<uint32_t>((pin.number % LowPinCount) * FieldWidth);
+      const auto field = static_cast<uint32_t>(pin.mode) | (static_cast<uint32_t>(pin.ioType) << TypeShift);
+      auto& mask = (pin.number < LowPinCount) ? lowMask : highMask;
+      auto& value = (pin.number < LowPinCount) ? lowValue : highValue;
+
+      mask |= FieldMask << shift;
+      value = (value & ~(FieldMask << shift)) | (field << shift);
+
+      return *this;
+    }
+
+    /// @brief Returns the fields of the configured pins in the low configuration register.
+    /// @return Mask of the fields.
+    constexpr uint32_t GetLowMask() const
+    {
+      return lowMask;
+    }
+
+    /// @brief Returns the values of the configured pins in the low configuration register.
+    /// @return Field values.
+    constexpr uint32_t GetLowValue() const
+    {
+      return lowValue;
+    }
+
+    /// @brief Returns the fields of the configured pins in the high configuration register.
+    /// @return Mask of the fields.
+    constexpr uint32_t GetHighMask() const
+    {
+      return highMask;
+    }
+
+    /// @brief Returns the values of the configured pins in the high configuration register.
+    /// @return Field values.
+    constexpr uint32_t GetHighValue() const
+    {
+      return highValue;
+    }
+  };
+
+  /// @brief Configures and writes masks of pins of a port given at runtime.
+  /// @tparam Registers Register block of the port, replaced by a simulation in the tests.
+  template<typename Registers = GPIO_TypeDef>
+  class PortWriter
+  {
+   private:
+    /// @brief Offset of the reset bits in the bit set/reset register.
+    static constexpr uint32_t ResetShift = 16U;
+
+    /// @brief Registers of the GPIO port.
+    Registers* port;
+
+   public:
+    /// @brief Constructor for the PortWriter class.
+    /// @param port Pointer to the GPIO port (e.g., GPIOA, GPIOB, etc.).
+    constexpr explicit PortWriter(Registers* port) : port {port}
+    {
+    }
+
+    /// @brief Applies a configuration, the pins not contained keep theirs.
+    /// @param configuration Merged configuration of the pins.
+    /// @details Reads and writes each configuration register once, a register without configured pins is not
+    ///          accessed. The clock of the port has to be enabled.
+    void Configure(const PortConfiguration& configuration) const
+    {
+      if (configuration.GetLowMask() != 0)
+      {
+        port->CRL = (port->CRL & ~configuration.GetLowMask()) | configuration.GetLowValue();
+      }
+
+      if (configuration.GetHighMask() != 0)
+      {
+        port->CRH = (port->CRH & ~configuration.GetHighMask()) | configuration.GetHighValue();
+      }
+    }
+
+    /// @brief Drives the pins of the mask high.
+    /// @param mask Mask of the pins.
+    void Set(const uint32_t mask) const
+    {
+      port->BSRR = mask;
+    }
+
+    /// @brief Drives the pins of the mask low.
+    /// @param mask Mask of the pins.
+    void Clear(const uint32_t mask) const
+    {
+      port->BRR = mask;
+    }
+
+    /// @brief Sets the state of the pins of the mask, the other pins are not written.
+    /// @param mask Mask of the pins.
+    /// @param states Desired states, a set bit drives the pin high.
+    void Write(const uint32_t mask, const uint32_t states) const
+    {
+      port->BSRR = (states & mask) | ((~states & mask) << ResetShift);
+    }
+
+    /// @brief Reads the state of the pins of the mask.
+    /// @param mask Mask of the pins.
+    /// @return States of the pins of the mask, the other bits are zero.
+    uint32_t Read(const uint32_t mask) const
+    {
+      return port->IDR & mask;
+    }
+  };
+
+  /// @brief Group of pins of one port known at compile time, configured and written together.
+  /// @tparam PortBase Base address of the GPIO port (e.g., GPIOB_BASE).
+  /// @tparam Numbers Pin numbers within the GPIO port (0-15).
+  template<uintptr_t PortBase, size_t... Numbers>
+  class PinGroup
+  {
+   private:
+    static_assert(sizeof...(Numbers) > 0 && ((Numbers < 16) && ...), "A GPIO port has 16 pins");
+
+    /// @brief Returns the writer of the port.
+    /// @return Writer of the GPIO port registers.
+    static PortWriter<> GetWriter()
+    {
+      return PortWriter<>(reinterpret_cast<GPIO_TypeDef*>(PortBase));
+    }
+
+   public:
+    /// @brief Bitmask of the pins within the GPIO port.
+    static constexpr uint32_t Mask = ((1U << Numbers) | ...);
+
+    static_assert(std::popcount(Mask) == sizeof...(Numbers), "The pins of a group have to be distinct");
+
+    // Deleted copy and move constructors and assignment operators.
+    PinGroup(const PinGroup&) = delete;
+    PinGroup& operator=(const PinGroup&) = delete;
+    PinGroup(PinGroup&&) = delete;
+    PinGroup& operator=(PinGroup&&) = delete;
+    ~PinGroup() = default;
+
+    /// @brief Constructor for the PinGroup class.
+    /// @param mode The mode of the GPIO pins (e.g., Input, OutputLow, etc.).
+    /// @param ioType The input/output type of the GPIO pins (e.g., AnalogMode_PushPull, Floating_OpenDrain, etc.).
+    /// @details Enables the clock of the port with one write and configures all pins with one write per
+    ///          configuration register.
+    PinGroup(const Mode mode, const InputOutputType ioType)
+    {
+      RCC->APB2ENR |= GetClockEnableMask(PortBase);
+      GetWriter().Configure(PortConfiguration {PinConfig {Numbers, mode, ioType}...});
+    }
+
+    /// @brief Constructor for the PinGroup class with AFIO configuration.
+    /// @param mode The mode of the GPIO pins (e.g., Input, OutputLow, etc.).
+    /// @param ioType The input/output type of the GPIO pins (e.g., AnalogMode_PushPull, Floating_OpenDrain, etc.).
+    /// @param afioConfig The AFIO configuration for the GPIO pins.
+    PinGroup(const Mode mode, const InputOutputType ioType, const AfioConfig& afioConfig) : PinGroup(mode, ioType)
+    {
+      ConfigureAfio(afioConfig);
+    }
+
+    /// @brief Drives all pins of the group high.
+    static void Set()
+    {
+      GetWriter().Set(Mask);
+    }
+
+    /// @brief Drives all pins of the group low.
+    static void Clear()
+    {
+      GetWriter().Clear(Mask);
+    }
+
+    /// @brief Sets the state of all pins of the group with a single store.
+    /// @param states Desired states as port bits, a set bit drives the pin high, bits of other pins are ignored.
+    static void Write(const uint32_t states)
+    {
+      GetWriter().Write(Mask, states);
+    }
+
+    /// @brief Reads the state of all pins of the group with a single load.
+    /// @return States as port bits, the bits of other pins are zero.
+    static uint32_t Read()
+    {
+      return GetWriter().Read(Mask);
+    }
+  };
+}  // namespace Peripherals::Gpio
+
+#endif
@@ -4,21 +4,106 @@
 /// @version 1.0
 /// @brief This file defines the Reset and Clock Control (RCC) class.
 /// @details The `ResetAndClockControl` class provides methods to configure the system clocks, SysTick timer, and to
-///          manage delays using the SysTick timer.
+///          manage delays using the SysTick timer. While waiting, the core sleeps with the periodic tick suppressed.
+///          The system clock can be switched between clock profiles at runtime, the millisecond ticks and the cycle
+///          timestamps continue across a switch and the registered drivers adapt their dividers.
 
 #ifndef PERIPHERALS_INC_RCC_HPP
 #define PERIPHERALS_INC_RCC_HPP
 
 #include <stm32f1xx.h>
 
+#include <ClockConfig.hpp>
+#include <TicklessIdle.hpp>
+#include <Timebase.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 namespace Peripherals::Rcc
 {
+  /// @brief Clock profile of the system clock.
+  enum class ClockProfile : uint8_t
+  {
+    /// @brief Internal 8 MHz oscillator, for idle periods.
+    Low = 0,
+
+    /// @brief PLL at 72 MHz, the profile after `Init()`.
+    High = 1,
+  };
+
+  /// @brief Phase of a clock switch a listener is notified about.
+  enum class ClockChange : uint8_t
+  {
+    /// @brief The clocks are about to change, transfers in progress should be completed.
+    Pending = 0,
+
+    /// @brief The clocks changed, the dividers have to be recomputed.
+    Completed = 1,
+  };
+
+  /// @brief Callback notified about clock switches.
+  /// @details Receives the context given at registration, the phase of the switch and the previous and new clock
+  ///          configurations. Both notifications are sent from the thread switching the clock.
+  using ClockListener = void (*)(void* context, ClockChange change, const ClockConfig& previous,
+    const ClockConfig& current);
+
+  /// @brief Check whether work became pending, called with interrupts masked right before the core sleeps.
+  /// @details Receives the context given with the check. An interrupt handler may have made work ready after the
+  ///          caller decided to sleep, its interrupt is no longer pending then and would not wake the core.
+  using WakeCheck = bool (*)(void* context);
+
+  /// @brief Statistics of the clock switches.
+  struct ClockSwitchStatistics
+  {
+    /// @brief Number of clock switches.
+    uint32_t switches;
+
+    /// @brief Duration of the last switch in cycles of the high profile, including the notifications.
+    uint32_t lastLatency;
+
+    /// @brief Longest switch in cycles of the high profile.
+    uint32_t maxLatency;
+  };
+
   /// @brief Class to manage the Reset and Clock Control (RCC).
   class ResetAndClockControl
   {
    private:
-    /// @brief Current SysTick counter value.
-    uint32_t sysTick;
+    /// @brief Maximum number of clock listeners, enough for USART1 and the timers TIM2 to TIM4.
+    static constexpr std::size_t MaxClockListeners = 4;
+
+    /// @brief Registration of a clock listener.
+    struct ClockListenerEntry
+    {
+      /// @brief Callback, nullptr if the entry is unused.
+      ClockListener listener = nullptr;
+
+      /// @brief Context passed to the callback.
+      void* context = nullptr;
+    };
+
+    /// @brief Millisecond tick counter.
+    /// @details Incremented by the SysTick interrupt while the threads read it, it does not wrap around.
+    Time::TickCounter sysTick {};
+
+    /// @brief Current clock profile, the core runs from the internal oscillator until `Init()`.
+    volatile ClockProfile profile = ClockProfile::Low;
+
+    /// @brief Number of clock switches, lets the timestamp readers detect a switch in between.
+    volatile uint32_t clockSwitches = 0;
+
+    /// @brief Registered clock listeners.
+    std::array<ClockListenerEntry, MaxClockListeners> clockListeners {};
+
+    /// @brief Statistics of the clock switches.
+    ClockSwitchStatistics clockSwitchStatistics {};
+
+    /// @brief Control register of the SysTick timer while it is stopped for the Stop mode.
+    uint32_t stopControl = 0;
+
+    /// @brief Value of the SysTick timer when it was stopped for the Stop mode.
+    uint32_t stopValue = 0;
 
     /// @brief Configures the system clocks.
     static void ConfigureClocks();
@@ -26,19 +111,92 @@ namespace Peripherals::Rcc
     /// @brief Configures the SysTick timer.
     static void ConfigureSysTick();
 
+    /// @brief Singleton instance, constant initialized so the accessor needs no guard.
+    static ResetAndClockControl instance;
+
     /// @brief Constructor for the ResetAndClockControl class.
-    /// @details Configures the system clocks and the SysTickTimer.
-    ResetAndClockControl();
+    /// @details Does not touch the hardware, `Init()` configures it.
+    constexpr ResetAndClockControl() = default;
+
+   public:
+    /// @brief Clock tree configurations of the clock profiles.
+    static constexpr std::array<ClockConfig, 2> Profiles = {
+      MakeClockConfig<HsiFrequency, 0>(),
+      MakeClockConfig<MaxSystemClock>(),
+    };
+
+    /// @brief Clock tree configuration of the high profile, the compile time dividers of the drivers derive from it.
+    static constexpr ClockConfig Clocks = Profiles[static_cast<std::size_t>(ClockProfile::High)];
+
+    /// @brief Number of ticks per millisecond, the SysTick and the cycle counter run with the AHB clock.
+    /// @details Refers to the high profile, the cycle timestamps are counted in its cycles in every profile.
+    static constexpr uint32_t Ticks = Clocks.ahbClock / 1000;
+
+    /// @brief Returns the number of SysTick cycles per millisecond of a clock profile.
+    /// @param profile Clock profile.
+    /// @return Cycles per millisecond.
+    static constexpr uint32_t GetTicks(const ClockProfile profile)
+    {
+      return Profiles[static_cast<std::size_t>(profile)].ahbClock / 1000;
+    }
+
+   private:
+    /// @brief Tick suppression arithmetic for the SysTick timer.
+    /// @tparam Profile Clock profile the SysTick timer runs with.
+    template<ClockProfile Profile>
+    using TickSuppressionType = Power::TickSuppression<GetTicks(Profile), SysTick_LOAD_RELOAD_Msk>;
+
+    /// @brief Idle residency counters, the sleep periods are recorded in cycles of the high profile.
+    Power::IdleResidency<Ticks> idleResidency {};
+
+    /// @brief Access to the SysTick timer for the timebase.
+    struct SysTickTimer
+    {
+      /// @brief Returns the current value of the SysTick timer.
+      /// @return Cycles remaining in the tick in progress.
+      static uint32_t GetValue()
+      {
+        return SysTick->VAL;
+      }
+
+      /// @brief Returns whether the SysTick interrupt is pending.
+      /// @return True if the tick interrupt has not run yet.
+      static bool IsReloadPending()
+      {
+        return (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+      }
+    };
+
+    /// @brief Sleeps with the tick suppression of a clock profile.
+    /// @tparam Profile Current clock profile.
+    /// @param deadline Tick at which to wake up at the latest.
+    /// @details Interrupts have to be masked by the caller from reading the profile on, or a clock switch in between
+    ///          would plan the sleep with the cycles per tick of the other profile.
+    template<ClockProfile Profile>
+    void Sleep(uint32_t deadline);
+
+    /// @brief Reads a cycle timestamp with the SysTick timer running in a clock profile.
+    /// @tparam Profile Current clock profile.
+    /// @return Cycles of the high profile since the SysTick timer was started.
+    template<ClockProfile Profile>
+    uint64_t ReadCycles() const
+    {
+      return Time::ReadCycles<GetTicks(Profile), SysTickTimer>(sysTick) * (Ticks / GetTicks(Profile));
+    }
+
+    /// @brief Notifies the registered clock listeners.
+    /// @param change Phase of the clock switch.
+    /// @param previous Previous clock configuration.
+    /// @param current New clock configuration.
+    void NotifyClockListeners(ClockChange change, const ClockConfig& previous, const ClockConfig& current) const;
 
    public:
-    /// @brief Number of ticks per millisecond.
-    static constexpr uint32_t Ticks = 72000;
 
     /// @brief Returns the singleton instance of the ResetAndClockControl class.
     /// @return Reference to the singleton instance.
-    static ResetAndClockControl& GetInstance()
+    /// @details The instance is placed statically, so the call compiles to the address of the object.
+    static constexpr ResetAndClockControl& GetInstance()
     {
-      static ResetAndClockControl instance;
       return instance;
     }
 
@@ -49,23 +207,155 @@ namespace Peripherals::Rcc
     ResetAndClockControl& operator=(ResetAndClockControl&&) = delete;
     ~ResetAndClockControl() = default;
 
+    /// @brief Configures the system clocks, the SysTick timer and the cycle counter.
+    /// @details Has to be called first in `main`, before any other peripheral is configured.
+    void Init();
+
+    /// @brief Starts the external crystal without waiting for it to become stable.
+    /// @details Called by the reset handler before the RAM is initialized, so the crystal settles meanwhile and
+    ///          `Init()` waits less. Must neither use the instance nor any other variable.
+    static void StartOscillators();
+
     /// @brief Delays execution for a specified number of milliseconds.
     /// @param milliseconds Number of milliseconds to delay.
-    void Delay(const uint32_t milliseconds) const;
+    /// @details The core sleeps until the delay has elapsed.
+    void Delay(const uint32_t milliseconds);
+
+    /// @brief Sleeps until the given tick is reached or an interrupt occurs.
+    /// @param deadline Tick at which to wake up at the latest.
+    /// @details The periodic SysTick interrupt is suppressed and the timer is programmed to fire once at the deadline,
+    ///          or after the maximum reload of the timer if the deadline is further away. The tick counter is
+    ///          compensated for the suppressed ticks after waking up.
+    /// @param pending Check skipping the sleep if work became pending, nullptr if there is none.
+    /// @param context Context passed to the check.
+    void Idle(const uint32_t deadline, WakeCheck pending = nullptr, void* context = nullptr);
+
+    /// @brief Switches the system clock to a clock profile.
+    /// @param target Clock profile to switch to.
+    /// @details Notifies the clock listeners before and after the switch. The SysTick timer is handed over to the new
+    ///          clock within the tick in progress, so the millisecond ticks and cycle timestamps continue, only the
+    ///          few cycles of the source switch itself are lost. Interrupts are disabled only around the source switch,
+    ///          the PLL locks while the system keeps running. Must be called from a thread, not from an interrupt.
+    void SetSystemClock(ClockProfile target);
+
+    /// @brief Prepares the clocks for the Stop mode and stops the SysTick timer.
+    /// @param pending Check skipping the Stop mode if work became pending, nullptr if there is none.
+    /// @param context Context passed to the check.
+    /// @return True if the core may enter the Stop mode, interrupts are disabled then. False if a tick is due or work
+    ///         is pending, the SysTick timer runs on and interrupts are enabled again.
+    /// @details Notifies the clock listeners about the pending stop, so transfers in progress complete. Must be
+    ///          followed by `RestoreClocks()` and `LeaveStop()` once the core woke up.
+    bool EnterStop(WakeCheck pending = nullptr, void* context = nullptr);
+
+    /// @brief Restores the clock tree of the current profile after the Stop mode.
+    /// @details The core wakes up from the internal oscillator, the crystal and the PLL are off. The prescalers and
+    ///          wait states are kept, so only the oscillators are started and the source is switched again.
+    /// @return Time from the call until the clocks run again in microseconds.
+    /// @details The cycle counter runs from the internal oscillator until the source is switched and from the system
+    ///          clock afterwards, so both parts are converted with their own frequency.
+    uint32_t RestoreClocks();
+
+    /// @brief Restarts the SysTick timer after the Stop mode and enables interrupts.
+    /// @param elapsedCycles Time spent with the SysTick timer stopped in cycles of the high profile, measured by the
+    ///                      real time clock.
+    /// @details The tick counter is advanced by the ticks passed meanwhile and the tick boundaries are kept.
+    void LeaveStop(uint64_t elapsedCycles);
+
+    /// @brief Returns the current clock profile.
+    /// @return Current clock profile.
+    inline ClockProfile GetClockProfile() const
+    {
+      return profile;
+    }
+
+    /// @brief Returns the clock configuration of the current profile.
+    /// @return Current clock configuration.
+    inline const ClockConfig& GetClocks() const
+    {
+      return Profiles[static_cast<std::size_t>(profile)];
+    }
+
+    /// @brief Registers a callback notified about clock switches.
+    /// @param listener Callback to register.
+    /// @param context Context passed to the callback.
+    /// @return True if the callback was registered, false if all entries are used.
+    bool AddClockListener(ClockListener listener, void* context);
+
+    /// @brief Returns the statistics of the clock switches.
+    /// @return Clock switch statistics.
+    inline const ClockSwitchStatistics& GetClockSwitchStatistics() const
+    {
+      return clockSwitchStatistics;
+    }
+
+    /// @brief Returns the idle residency counters.
+    /// @return Idle residency counters.
+    inline const Power::IdleStatistics& GetIdleStatistics() const
+    {
+      return idleResidency.GetStatistics();
+    }
 
     /// @brief Gets the current SysTick counter value.
-    /// @return Current SysTick counter value.
+    /// @return Current SysTick counter value, wraps around after about 49 days.
     inline uint32_t GetSysTick() const
     {
-      return sysTick;
+      return sysTick.GetLow();
+    }
+
+    /// @brief Returns a wrap free timestamp with cycle resolution.
+    /// @return Core clock cycles since the SysTick timer was started.
+    /// @details Combines the tick counter with the current value of the SysTick timer. Safe to call from threads and
+    ///          interrupt handlers, also while interrupts are disabled for less than a tick. The timestamps count in
+    ///          cycles of the high profile, in the low profile they advance in steps of several cycles.
+    inline uint64_t Now() const
+    {
+      for (;;)
+      {
+        const auto switches = clockSwitches;
+        const auto cycles =
+          (profile == ClockProfile::High) ? ReadCycles<ClockProfile::High>() : ReadCycles<ClockProfile::Low>();
+
+        if (switches == clockSwitches)
+        {
+          return cycles;
+        }
+      }
     }
 
     /// @brief Handles the SysTick interrupt.
     inline void HandleInterrupt()
     {
-      ++sysTick;
+      sysTick.Advance(1);
+    }
+  };
+
+  static_assert(ResetAndClockControl::Ticks % ResetAndClockControl::GetTicks(ClockProfile::Low) == 0,
+    "The timestamps count in cycles of the high profile, which have to scale exactly to the low profile");
+
+  /// @brief Tick source reading the millisecond SysTick counter, used by the scheduler.
+  struct SysTickSource
+  {
+    /// @brief Returns the current SysTick counter value.
+    /// @return Current SysTick counter value in milliseconds.
+    static uint32_t Now()
+    {
+      return ResetAndClockControl::GetInstance().GetSysTick();
+    }
+  };
+
+  /// @brief Source of the cycle timestamps, used by the steady clock.
+  struct CycleSource
+  {
+    /// @brief Returns the current timestamp.
+    /// @return Core clock cycles since start.
+    static uint64_t Now()
+    {
+      return ResetAndClockControl::GetInstance().Now();
     }
   };
+
+  /// @brief Monotonic clock with cycle resolution, compatible with `std::chrono`.
+  using SteadyClock = Time::CycleClock<CycleSource, ResetAndClockControl::Ticks * 1000>;
 }  // namespace Peripherals::Rcc
 
 #endif
@@ -0,0 +1,151 @@
+/// @file Rtc.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Provides the real time clock (RTC) class.
+/// @details The RTC counts seconds from the low speed crystal in the backup domain, which keeps running across
+///          resets as long as the supply or the backup battery is present. A backup register marks the domain as
+///          configured, so a reset only resynchronizes the registers and the time is kept. The callbacks run in the
+///          RTC interrupt, whose priority is set by the `InterruptManager`. The alarm is routed to EXTI line 17 as
+///          well, so it wakes the core from Stop mode. The power manager shares the alarm register with the
+///          application, the earlier of both is programmed.
+
+#ifndef PERIPHERALS_INC_RTC_HPP
+#define PERIPHERALS_INC_RTC_HPP
+
+#include <stm32f1xx.h>
+
+#include <ClockConfig.hpp>
+#include <cstdint>
+
+namespace Peripherals::Rtc
+{
+  /// @brief Callback invoked in the RTC interrupt.
+  /// @details Receives the context given at registration and the counter value in seconds.
+  using Callback = void (*)(void* context, uint32_t counter);
+
+  /// @brief Real time clock class.
+  /// @details This class provides the seconds counter, a seconds callback and an alarm.
+  class RealTimeClock
+  {
+   private:
+    /// @brief Value of the backup register once the backup domain is configured.
+    static constexpr uint16_t ConfiguredMarker = 0x5A17;
+
+    /// @brief Prescaler register value dividing the crystal down to one count per second.
+    static constexpr uint32_t Prescaler = Rcc::LseFrequency - 1;
+
+    /// @brief Callback invoked every second, nullptr if not registered.
+    Callback secondCallback = nullptr;
+
+    /// @brief Context passed to the seconds callback.
+    void* secondContext = nullptr;
+
+    /// @brief Callback invoked once the alarm expires, nullptr if no alarm is set.
+    Callback alarmCallback = nullptr;
+
+    /// @brief Context passed to the alarm callback.
+    void* alarmContext = nullptr;
+
+    /// @brief Counter value of the application alarm.
+    uint32_t alarm = 0;
+
+    /// @brief Counter value of the wakeup alarm of the power manager.
+    uint32_t wakeup = 0;
+
+    /// @brief Whether the power manager set a wakeup alarm.
+    bool wakeupSet = false;
+
+    /// @brief Whether the RTC is initialized.
+    bool initialized = false;
+
+    /// @brief Singleton instance, constant initialized so the accessor needs no guard.
+    static RealTimeClock instance;
+
+    /// @brief Private constructor to prevent instantiation.
+    constexpr RealTimeClock() = default;
+
+    /// @brief Configures the backup domain after power up, starts the crystal and the counter from zero.
+    static void ConfigureBackupDomain();
+
+    /// @brief Waits for the last write to the RTC registers to complete and enters the configuration mode.
+    static void EnterConfiguration();
+
+    /// @brief Leaves the configuration mode and waits until the written values are taken over.
+    static void ExitConfiguration();
+
+    /// @brief Programs the earlier of the application alarm and the wakeup alarm, disables the alarm interrupt if
+    ///        neither is set.
+    void UpdateAlarm() const;
+
+   public:
+    /// @brief Returns the singleton instance of the real time clock class.
+    /// @return Reference to the singleton instance.
+    static constexpr RealTimeClock& GetInstance()
+    {
+      return instance;
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    RealTimeClock(const RealTimeClock&) = delete;
+    RealTimeClock& operator=(const RealTimeClock&) = delete;
+    RealTimeClock(RealTimeClock&&) = delete;
+    RealTimeClock& operator=(RealTimeClock&&) = delete;
+    ~RealTimeClock() = default;
+
+    /// @brief Enables the access to the backup domain and starts the real time clock if it does not run yet.
+    /// @details After power up, the start of the low speed crystal takes up to a few seconds. After a reset, only the
+    ///          registers are resynchronized, which takes up to two RTC clock cycles. Further calls return at once.
+    void Init();
+
+    /// @brief Waits until the registers are synchronized with the RTC core again.
+    /// @details Required after the APB1 clock was stopped, e.g. in Stop mode, before the counter is read.
+    static void Resynchronize();
+
+    /// @brief Returns the current counter value.
+    /// @return Seconds since 1970-01-01 00:00:00.
+    /// @details The two halves are read twice, a carry in between leads to a retry.
+    uint32_t GetCounter() const;
+
+    /// @brief Returns the current time with the resolution of the crystal.
+    /// @return Crystal cycles since 1970-01-01 00:00:00.
+    /// @details Combines the counter with the prescaler divider, which counts down within the second.
+    uint64_t GetPreciseCounter() const;
+
+    /// @brief Sets the counter value.
+    /// @param counter Seconds since 1970-01-01 00:00:00.
+    void SetCounter(uint32_t counter);
+
+    /// @brief Registers the callback invoked every second and enables its interrupt.
+    /// @param callback Callback invoked every second with the new counter value, nullptr to disable it.
+    /// @param context Context passed to the callback.
+    void SetSecondCallback(Callback callback, void* context);
+
+    /// @brief Sets the alarm, replacing a pending one.
+    /// @param counter Counter value at which the alarm expires, it has to be in the future.
+    /// @param callback Callback invoked once when the alarm expires.
+    /// @param context Context passed to the callback.
+    /// @details Waits for up to three RTC clock cycles until the alarm register is written.
+    void SetAlarm(uint32_t counter, Callback callback, void* context);
+
+    /// @brief Cancels a pending alarm.
+    void CancelAlarm();
+
+    /// @brief Sets the alarm waking the core from Stop mode, the application alarm stays in effect.
+    /// @param counter Counter value at which the core wakes up at the latest, it has to be in the future.
+    /// @details Must be called with interrupts disabled, together with `ClearWakeup()`.
+    void SetWakeup(uint32_t counter);
+
+    /// @brief Removes the wakeup alarm after the core woke up.
+    /// @details An expired wakeup alarm is discarded, an expired application alarm is left for the interrupt.
+    void ClearWakeup();
+
+    /// @brief Handles the RTC interrupt by invoking the callbacks of the set flags.
+    void HandleInterrupt();
+
+    /// @brief Handles the interrupt of the alarm line of the EXTI, which only wakes the core.
+    static void HandleAlarmInterrupt();
+  };
+}  // namespace Peripherals::Rtc
+
+#endif
@@ -0,0 +1,234 @@
+/// @file Timer.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Provides the general purpose timer (TIM2, TIM3, TIM4) class.
+/// @details The `Timer` class runs the 16 bit counter of a general purpose timer freely and uses its four channels
+///          for compare events and input captures. Compare events are one-shot or periodic, the next match of a
+///          periodic event is derived from the previous one, so the period does not drift with the interrupt latency.
+///          The callbacks run in the timer interrupt, whose priority is set by the `InterruptManager`.
+
+#ifndef PERIPHERALS_INC_TIMER_HPP
+#define PERIPHERALS_INC_TIMER_HPP
+
+#include <stm32f1xx.h>
+
+#include <Rcc.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Peripherals::Timer
+{
+  /// @brief Timer instance enumeration.
+  /// @details This enumeration defines the available general purpose timer instances.
+  enum class TimerInstance : uint8_t
+  {
+    /// @brief TIM2 instance.
+    Tim2 = 0,
+
+    /// @brief TIM3 instance.
+    Tim3 = 1,
+
+    /// @brief TIM4 instance.
+    Tim4 = 2,
+  };
+
+  /// @brief Capture compare channel of a timer.
+  enum class Channel : uint8_t
+  {
+    /// @brief Channel 1.
+    Channel1 = 0,
+
+    /// @brief Channel 2.
+    Channel2 = 1,
+
+    /// @brief Channel 3.
+    Channel3 = 2,
+
+    /// @brief Channel 4.
+    Channel4 = 3,
+  };
+
+  /// @brief Edge of the input signal which triggers a capture.
+  enum class Edge : uint8_t
+  {
+    /// @brief Rising edge.
+    Rising = 0,
+
+    /// @brief Falling edge.
+    Falling = 1,
+  };
+
+  /// @brief Callback invoked in the timer interrupt.
+  /// @details Receives the context given at registration and the counter value of the compare match or capture.
+  using Callback = void (*)(void* context, uint16_t value);
+
+  /// @brief General purpose timer class.
+  /// @details This class provides one-shot and periodic compare events and input captures on a free running counter.
+  class Timer
+  {
+   private:
+    /// @brief Number of capture compare channels.
+    static constexpr std::size_t ChannelCount = 4;
+
+    /// @brief Number of timer instances.
+    static constexpr std::size_t InstanceCount = 3;
+
+    /// @brief Use of a channel.
+    enum class ChannelMode : uint8_t
+    {
+      /// @brief The channel is unused.
+      Idle,
+
+      /// @brief One-shot compare event.
+      OneShot,
+
+      /// @brief Periodic compare event.
+      Periodic,
+
+      /// @brief Input capture.
+      Capture,
+    };
+
+    /// @brief Registration of a channel.
+    struct ChannelState
+    {
+      /// @brief Use of the channel.
+      ChannelMode mode = ChannelMode::Idle;
+
+      /// @brief Callback invoked on a match or capture, nullptr if the channel is unused.
+      Callback callback = nullptr;
+
+      /// @brief Context passed to the callback.
+      void* context = nullptr;
+
+      /// @brief Counter ticks between two periodic compare events.
+      uint16_t period = 0;
+    };
+
+    /// @brief Pointer to the timer peripheral.
+    TIM_TypeDef* peripheral = nullptr;
+
+    /// @brief Registrations of the channels.
+    std::array<ChannelState, ChannelCount> channels {};
+
+    /// @brief Singleton instances indexed by `TimerInstance`, constant initialized so the accessor needs no guard.
+    static std::array<Timer, InstanceCount> instances;
+
+    /// @brief Private constructor to prevent instantiation.
+    constexpr Timer() = default;
+
+    /// @brief Enables the clock of the timer peripheral.
+    void ConfigureClocks() const;
+
+    /// @brief Returns the compare register of a channel.
+    /// @param channel Channel to get the register for.
+    /// @return Reference to the capture compare register.
+    volatile uint32_t& GetCompareRegister(Channel channel) const;
+
+    /// @brief Sets the mode bits of a channel in the capture compare mode register.
+    /// @param channel Channel to configure.
+    /// @param mode Eight mode bits of the channel.
+    void SetChannelMode(Channel channel, uint32_t mode) const;
+
+    /// @brief Changes the prescaler to keep the counter frequency after the timer clock changed.
+    /// @param previousClock Previous timer clock in Hz.
+    /// @param clock New timer clock in Hz.
+    void Rescale(uint32_t previousClock, uint32_t clock);
+
+    /// @brief Registers a compare event and enables its interrupt.
+    /// @param channel Channel to use.
+    /// @param state Registration of the channel.
+    /// @param delay Counter ticks from now until the first match.
+    void StartCompare(Channel channel, const ChannelState& state, uint16_t delay);
+
+   public:
+    /// @brief Returns the singleton instance of the timer class.
+    /// @param Instance Timer instance to get the singleton for.
+    /// @return Reference to the singleton instance.
+    /// @details The instances are placed statically, so the call compiles to the address of the object.
+    template<TimerInstance Instance>
+    static constexpr Timer& GetInstance()
+    {
+      return instances[static_cast<std::size_t>(Instance)];
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    Timer& operator=(Timer&&) = delete;
+    ~Timer() = default;
+
+    /// @brief Calculates the prescaler for the specified counter frequency at compile time.
+    /// @param frequency Counter frequency in Hz.
+    /// @param clockInTicks Clock frequency of the timer in ticks, by default the timer clock of APB1.
+    /// @return Prescaler register value, the counter frequency is rounded up to the next reachable one.
+    static constexpr uint16_t GetPrescaler(
+      const uint32_t frequency, const uint32_t clockInTicks = Rcc::ResetAndClockControl::Clocks.apb1TimerClock / 1000)
+    {
+      const auto clock = static_cast<uint64_t>(clockInTicks) * 1000;
+      const auto divider = frequency >= clock ? 1 : clock / frequency;
+
+      return static_cast<uint16_t>(divider > 0x10000U ? 0xFFFFU : divider - 1);
+    }
+
+    /// @brief Configures the timer as free running counter and starts it.
+    /// @param peripheral Pointer to the timer peripheral.
+    /// @param prescaler Prescaler register value, the counter runs with the timer clock / (prescaler + 1).
+    /// @details The first configuration registers `HandleClockChange()` as clock listener, so the counter frequency is
+    ///          kept across clock switches.
+    void Configure(TIM_TypeDef* peripheral, uint16_t prescaler);
+
+    /// @brief Returns the current counter value.
+    /// @return Counter value.
+    uint16_t GetCounter() const
+    {
+      return static_cast<uint16_t>(peripheral->CNT);
+    }
+
+    /// @brief Starts a one-shot compare event.
+    /// @param channel Channel to use.
+    /// @param delay Counter ticks from now until the event, at most 65535. A delay shorter than the few cycles needed
+    ///              to program the channel is missed and the event follows after a full counter period.
+    /// @param callback Callback invoked once the counter matches.
+    /// @param context Context passed to the callback.
+    void StartOneShot(Channel channel, uint16_t delay, Callback callback, void* context);
+
+    /// @brief Starts a periodic compare event.
+    /// @param channel Channel to use.
+    /// @param period Counter ticks between two events, the first one follows after one period.
+    /// @param callback Callback invoked on every match.
+    /// @param context Context passed to the callback.
+    void StartPeriodic(Channel channel, uint16_t period, Callback callback, void* context);
+
+    /// @brief Starts capturing the counter on edges of the channel input.
+    /// @param channel Channel whose input pin is captured.
+    /// @param edge Edge triggering the capture.
+    /// @param callback Callback invoked with the captured counter value.
+    /// @param context Context passed to the callback.
+    /// @details The input pin has to be configured as floating input.
+    void StartCapture(Channel channel, Edge edge, Callback callback, void* context);
+
+    /// @brief Stops the compare event or capture of a channel.
+    /// @param channel Channel to stop.
+    void Stop(Channel channel);
+
+    /// @brief Handles the timer interrupt by invoking the callbacks of the flagged channels.
+    void HandleInterrupt();
+
+    /// @brief Adapts the prescaler to a clock switch, registered as clock listener by `Configure()`.
+    /// @param context Timer instance.
+    /// @param change Phase of the clock switch.
+    /// @param previous Previous clock configuration.
+    /// @param current New clock configuration.
+    /// @details The prescaler is scaled to keep the counter frequency, which is rounded to the closest reachable one.
+    ///          The counter restarts from zero and the pending compare events are moved along, captured values before
+    ///          and after the switch cannot be compared.
+    static void HandleClockChange(
+      void* context, Rcc::ClockChange change, const Rcc::ClockConfig& previous, const Rcc::ClockConfig& current);
+  };
+}  // namespace Peripherals::Timer
+
+#endif
@@ -12,8 +12,10 @@
 
 #include <stm32f1xx.h>
 
+#include <Events.hpp>
 #include <Peripherals.hpp>
 #include <Rcc.hpp>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -43,17 +45,26 @@ namespace Peripherals::Usart
   class UniversalSynchronousAsynchronousReceiverTransmitter
   {
    private:
+    /// @brief Number of USART instances.
+    static constexpr std::size_t InstanceCount = 3;
+
+    /// @brief Singleton instances indexed by `UsartInstance`, constant initialized so the accessor needs no guard.
+    static std::array<UniversalSynchronousAsynchronousReceiverTransmitter, InstanceCount> instances;
+
     /// @brief Pointer to the USART peripheral.
-    USART_TypeDef* peripheral;
+    USART_TypeDef* peripheral = nullptr;
 
     /// @brief Mantissa part of the baud rate.
-    size_t mantissa;
+    size_t mantissa = 0;
 
     /// @brief Fraction part of the baud rate.
-    size_t fraction;
+    size_t fraction = 0;
+
+    /// @brief Bus clock in Hz the mantissa and fraction were computed for, 0 until the first clock switch.
+    uint32_t configuredClock = 0;
 
     /// @brief Private constructor to prevent instantiation.
-    UniversalSynchronousAsynchronousReceiverTransmitter() = default;
+    constexpr UniversalSynchronousAsynchronousReceiverTransmitter() = default;
 
     /// @brief Configures the clocks for the USART peripheral.
     void ConfigureClocks() const;
@@ -65,11 +76,11 @@ namespace Peripherals::Usart
     /// @brief Returns the singleton instance of the USART class.
     /// @param Instance USART instance to get the singleton for.
     /// @return Reference to the singleton instance.
+    /// @details The instances are placed statically, so the call compiles to the address of the object.
     template<UsartInstance Instance>
-    static UniversalSynchronousAsynchronousReceiverTransmitter& GetInstance()
+    static constexpr UniversalSynchronousAsynchronousReceiverTransmitter& GetInstance()
     {
-      static UniversalSynchronousAsynchronousReceiverTransmitter instance;
-      return instance;
+      return instances[static_cast<std::size_t>(Instance)];
     }
 
     /// @brief Configures the USART peripheral with specified baud rate settings.
@@ -87,6 +98,33 @@ namespace Peripherals::Usart
       UniversalSynchronousAsynchronousReceiverTransmitter&&) = delete;
     ~UniversalSynchronousAsynchronousReceiverTransmitter() = default;
 
+    /// @brief Enables the receiver and its interrupt.
+    /// @details Every received character is posted as event, the NVIC interrupt has to be enabled as well.
+    void EnableReceiver() const;
+
+    /// @brief Handles the USART interrupt by posting the received character.
+    /// @param source Source of the posted event, the index of the USART instance.
+    void HandleInterrupt(uint8_t source) const;
+
+    /// @brief Adapts the baud rate divider to a clock switch, registered as clock listener by the application.
+    /// @param context USART instance.
+    /// @param change Phase of the clock switch.
+    /// @param previous Previous clock configuration.
+    /// @param current New clock configuration.
+    /// @details Waits for the transmission in progress before the switch and scales the divider to the new bus clock
+    ///          afterwards, so the baud rate is kept as closely as the new clock allows.
+    static void HandleClockChange(
+      void* context, Rcc::ClockChange change, const Rcc::ClockConfig& previous, const Rcc::ClockConfig& current);
+
+    /// @brief Returns the clock of the bus the USART instance is connected to.
+    /// @tparam Instance USART instance.
+    /// @return Clock frequency in ticks, USART1 is connected to APB2 and the others to APB1.
+    template<UsartInstance Instance>
+    static constexpr uint32_t GetClockInTicks()
+    {
+      return (Instance == UsartInstance::Usart1 ? RccType::Clocks.apb2Clock : RccType::Clocks.apb1Clock) / 1000;
+    }
+
     /// @brief Calculates the mantissa and fraction for the specified baud rate at compile time.
     /// @param baudRate Baud rate to calculate the mantissa and fraction for.
     /// @param clockInTicks Clock frequency in ticks.
@@ -0,0 +1,171 @@
+/// @file VectorTable.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Vector table defined in C++ at compile time and activated from RAM.
+/// @details The table of the startup file stays in flash for the reset, it holds the initial stack pointer and the
+///          reset handler. The application builds its vectors with a constexpr `VectorTable`, so a missing or an
+///          unused vector is found by a static assertion. At boot the table is copied into RAM and activated through
+///          the vector table offset register, then a handler is swapped at runtime with a single store.
+
+#ifndef PERIPHERALS_INC_VECTORTABLE_HPP
+#define PERIPHERALS_INC_VECTORTABLE_HPP
+
+#include <stm32f1xx.h>
+
+#include <Cpu.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace Peripherals::Vectors
+{
+  /// @brief Handler of an exception or interrupt.
+  using Handler = void (*)();
+
+  /// @brief Number of the vectors of the core, including the initial stack pointer.
+  constexpr std::size_t ExceptionCount = 16;
+
+  /// @brief Number of the interrupts of the device.
+  constexpr std::size_t InterruptCount = static_cast<std::size_t>(IRQn_Type::USBWakeUp_IRQn) + 1;
+
+  /// @brief Number of the vectors.
+  constexpr std::size_t VectorCount = ExceptionCount + InterruptCount;
+
+  /// @brief Alignment of a vector table, the size rounded up to a power of two and at least 128 bytes.
+  constexpr std::size_t TableAlignment = std::max<std::size_t>(128, std::bit_ceil(VectorCount * sizeof(Handler)));
+
+  /// @brief Returns the index of the vector of an exception or interrupt.
+  /// @param irq Number of the exception or interrupt, the exceptions of the core are negative.
+  /// @return Index in the vector table.
+  constexpr std::size_t IndexOf(const IRQn_Type irq)
+  {
+    return static_cast<std::size_t>(static_cast<int32_t>(ExceptionCount) + static_cast<int32_t>(irq));
+  }
+
+  /// @brief Handler bound to an exception or interrupt, used to build a table at compile time.
+  struct Binding
+  {
+    /// @brief Number of the exception or interrupt.
+    IRQn_Type irq;
+
+    /// @brief Handler of the exception or interrupt.
+    Handler handler;
+  };
+
+  /// @brief Vectors of the exceptions and interrupts, built at compile time.
+  /// @details A vector without handler is unused, it is replaced by a trap when the table is loaded into RAM.
+  class VectorTable
+  {
+   private:
+    /// @brief Handlers indexed by the vector, nullptr if unused.
+    std::array<Handler, VectorCount> vectors {};
+
+   public:
+    /// @brief Constructor for the VectorTable class.
+    /// @param bindings Handlers of the exceptions and interrupts, a vector given twice takes the last handler.
+    constexpr VectorTable(const std::initializer_list<Binding> bindings)
+    {
+      for (const auto& binding : bindings)
+      {
+        vectors[IndexOf(binding.irq)] = binding.handler;
+      }
+    }
+
+    /// @brief Returns whether a vector has a handler.
+    /// @param irq Number of the exception or interrupt.
+    /// @return True if a handler is bound.
+    constexpr bool IsUsed(const IRQn_Type irq) const
+    {
+      return vectors[IndexOf(irq)] != nullptr;
+    }
+
+    /// @brief Returns the handler of a vector.
+    /// @param index Index in the vector table.
+    /// @return Handler, nullptr if unused.
+    constexpr Handler Get(const std::size_t index) const
+    {
+      return vectors[index];
+    }
+
+    /// @brief Returns the number of the interrupts with a handler.
+    /// @return Number of the used device interrupts, the exceptions of the core are not counted.
+    constexpr std::size_t GetUsedInterrupts() const
+    {
+      return static_cast<std::size_t>(
+        std::count_if(vectors.begin() + ExceptionCount, vectors.end(), [](const Handler handler) {
+          return handler != nullptr;
+        }));
+    }
+  };
+
+  /// @brief Vector table in RAM, activated through the vector table offset register.
+  class RamVectorTable
+  {
+   private:
+    /// @brief Vectors fetched by the core once the table is active.
+    alignas(TableAlignment) std::array<Handler, VectorCount> vectors {};
+
+   public:
+    /// @brief Constructor for the RamVectorTable class.
+    constexpr RamVectorTable() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    RamVectorTable(const RamVectorTable&) = delete;
+    RamVectorTable& operator=(const RamVectorTable&) = delete;
+    RamVectorTable(RamVectorTable&&) = delete;
+    RamVectorTable& operator=(RamVectorTable&&) = delete;
+    ~RamVectorTable() = default;
+
+    /// @brief Copies a table built at compile time.
+    /// @param table Table to copy.
+    /// @param unused Handler of the unused vectors.
+    /// @details The initial stack pointer and the reset vector are only read from the table in flash.
+    void Load(const VectorTable& table, const Handler unused)
+    {
+      for (std::size_t index = 0; index < VectorCount; ++index)
+      {
+        const auto handler = table.Get(index);
+        vectors[index] = (handler != nullptr) ? handler : unused;
+      }
+    }
+
+    /// @brief Points the vector table offset register to this table.
+    /// @details The barriers make sure the copied vectors are written before the first exception fetches them.
+    void Activate() const
+    {
+      Cpu::DataSynchronizationBarrier();
+      SCB->VTOR = reinterpret_cast<uintptr_t>(vectors.data());
+      Cpu::DataSynchronizationBarrier();
+      Cpu::InstructionSynchronizationBarrier();
+    }
+
+    /// @brief Replaces the handler of a vector.
+    /// @param irq Number of the exception or interrupt.
+    /// @param handler New handler.
+    /// @details A single aligned store, so the interrupt may stay enabled. It takes the new handler from the next
+    ///          entry on.
+    void Set(const IRQn_Type irq, const Handler handler)
+    {
+      vectors[IndexOf(irq)] = handler;
+      Cpu::DataSynchronizationBarrier();
+    }
+
+    /// @brief Returns the handler of a vector.
+    /// @param irq Number of the exception or interrupt.
+    /// @return Current handler.
+    Handler Get(const IRQn_Type irq) const
+    {
+      return vectors[IndexOf(irq)];
+    }
+  };
+
+  /// @brief Vector table in RAM used by the application.
+  /// @details Zero initialized in .bss, it is filled by the interrupt manager before it is activated.
+  inline constinit RamVectorTable ramVectorTable {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace Peripherals::Vectors
+
+#endif  // PERIPHERALS_INC_VECTORTABLE_HPP
@@ -8,58 +8,30 @@
 
 #include <stm32f1xx.h>
 
+#include <PinGroup.hpp>
+#include <cstdint>
+
 using GpioType = Peripherals::Gpio::Gpio;
 
-GpioType::Gpio(GPIO_TypeDef* port,
+namespace
+{
+  /// @brief Offset of the reset bits in the bit set/reset register.
+  constexpr uint32_t RESET_SHIFT = 16U;
+}  // namespace
+
+void Peripherals::Gpio::ConfigurePin(GPIO_TypeDef* port,
   const size_t pin,
   const Peripherals::Gpio::Mode mode,
   const Peripherals::Gpio::InputOutputType ioType)
-  : port {port}, pin {pin}, pinMask {1U << pin}
 {
   // Enable the clock for the GPIO port
-  if (port == GPIOA)
-  {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPAEN;
-  }
-  else if (port == GPIOB)
-  {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPBEN;
-  }
-  else if (port == GPIOC)
-  {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPCEN;
-  }
-  else if (port == GPIOD)
-  {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPDEN;
-  }
-  else if (port == GPIOE)
-  {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPEEN;
-  }
+  RCC->APB2ENR |= GetClockEnableMask(reinterpret_cast<uintptr_t>(port));
 
   // Configure the pin mode and type
-  if (pin < LOW_PIN_COUNT)
-  {
-    port->CRL &= ~(PIN_CONFIG_MASK << (pin * MODE_SHIFT_MULTIPLIER));
-    port->CRL |= (static_cast<uint32_t>(mode) << (pin * MODE_SHIFT_MULTIPLIER)) |
-                 (static_cast<uint32_t>(ioType) << (pin * MODE_SHIFT_MULTIPLIER + CONFIG_SHIFT_ADDITION));
-  }
-  else
-  {
-    auto highPin = pin - LOW_PIN_COUNT;
-    port->CRH &= ~(PIN_CONFIG_MASK << (highPin * MODE_SHIFT_MULTIPLIER));
-    port->CRH |= (static_cast<uint32_t>(mode) << (highPin * MODE_SHIFT_MULTIPLIER)) |
-                 (static_cast<uint32_t>(ioType) << (highPin * MODE_SHIFT_MULTIPLIER + CONFIG_SHIFT_ADDITION));
-  }
+  PortWriter<>(port).Configure(PortConfiguration {PinConfig {pin, mode, ioType}});
 }
 
-GpioType::Gpio(GPIO_TypeDef* port,
-  const size_t pin,
-  const Peripherals::Gpio::Mode mode,
-  const Peripherals::Gpio::InputOutputType ioType,
-  const Peripherals::Gpio::AfioConfig& afioConfig)
-  : Gpio(port, pin, mode, ioType)
+void Peripherals::Gpio::ConfigureAfio(const Peripherals::Gpio::AfioConfig& afioConfig)
 {
   // Enable the AFIO clock
   RCC->APB2ENR |= RCC_APB2ENR_AFIOEN;
@@ -70,21 +42,34 @@ GpioType::Gpio(GPIO_TypeDef* port,
   AFIO->MAPR |= afioConfig.afioMode;
 }
 
+GpioType::Gpio(GPIO_TypeDef* port,
+  const size_t pin,
+  const Peripherals::Gpio::Mode mode,
+  const Peripherals::Gpio::InputOutputType ioType)
+  : port {port}, pin {pin}, pinMask {1U << pin}
+{
+  ConfigurePin(port, pin, mode, ioType);
+}
+
+GpioType::Gpio(GPIO_TypeDef* port,
+  const size_t pin,
+  const Peripherals::Gpio::Mode mode,
+  const Peripherals::Gpio::InputOutputType ioType,
+  const Peripherals::Gpio::AfioConfig& afioConfig)
+  : Gpio(port, pin, mode, ioType)
+{
+  ConfigureAfio(afioConfig);
+}
+
 void GpioType::SetState(const bool state) const
 {
-  if (state)
-  {
-    port->ODR |= pinMask;
-  }
-  else
-  {
-    port->ODR &= ~pinMask;
-  }
+  port->BSRR = state ? pinMask : (pinMask << RESET_SHIFT);
 }
 
 void GpioType::ToggleState() const
 {
-  port->ODR ^= pinMask;
+  // Only this pin is written, the other pins of the port keep the state they have when the store happens
+  port->BSRR = ((port->ODR & pinMask) != 0) ? (pinMask << RESET_SHIFT) : pinMask;
 }
 
 bool GpioType::GetState() const
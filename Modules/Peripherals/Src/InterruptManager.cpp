@@ -6,21 +6,227 @@
 
 #include <stm32f1xx.h>
 
+#include <Cpu.hpp>
+#include <Dwt.hpp>
 #include <Exti.hpp>
 #include <InterruptManager.hpp>
+#include <Kernel.hpp>
 #include <Rcc.hpp>
+#include <Rtc.hpp>
+#include <Timer.hpp>
+#include <TimerService.hpp>
+#include <Usart.hpp>
+#include <VectorTable.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 
 using InterruptManagerType = Peripherals::InterruptManager;
 using RccType = Peripherals::Rcc::ResetAndClockControl;
+using UsartType = Peripherals::Usart::UniversalSynchronousAsynchronousReceiverTransmitter;
+using TimerType = Peripherals::Timer::Timer;
+using RtcType = Peripherals::Rtc::RealTimeClock;
 
 // NOLINTBEGIN
 extern "C" void SysTick_Handler()
 {
-  RccType::GetInstance().HandleInterrupt();
+  auto& rcc = RccType::GetInstance();
+  rcc.HandleInterrupt();
+  Timers::timerService.OnTick(rcc.GetSysTick());
+
+  // Wake the threads whose sleep ended, the context switch follows once the handler returns
+  Kernel::kernel.OnTick(rcc.GetSysTick());
+}
+
+extern "C" void RTC_IRQHandler()
+{
+  RtcType::GetInstance().HandleInterrupt();
+}
+
+extern "C" void RTC_Alarm_IRQHandler()
+{
+  RtcType::HandleAlarmInterrupt();
 }
 
 extern "C" void EXTI0_IRQHandler()
 {
-  Peripherals::Exti::ExternalInterruptManager::HandleExti0Interrupt();
+  Peripherals::Exti::ExternalInterruptManager::HandleInterrupt<0>();
+}
+
+extern "C" void EXTI1_IRQHandler()
+{
+  Peripherals::Exti::ExternalInterruptManager::HandleInterrupt<1>();
+}
+
+extern "C" void EXTI2_IRQHandler()
+{
+  Peripherals::Exti::ExternalInterruptManager::HandleInterrupt<2>();
+}
+
+extern "C" void EXTI3_IRQHandler()
+{
+  Peripherals::Exti::ExternalInterruptManager::HandleInterrupt<3>();
+}
+
+extern "C" void EXTI4_IRQHandler()
+{
+  Peripherals::Exti::ExternalInterruptManager::HandleInterrupt<4>();
+}
+
+extern "C" void EXTI9_5_IRQHandler()
+{
+  Peripherals::Exti::ExternalInterruptManager::HandleExti9_5Interrupt();
+}
+
+extern "C" void EXTI15_10_IRQHandler()
+{
+  Peripherals::Exti::ExternalInterruptManager::HandleExti15_10Interrupt();
+}
+
+extern "C" void USART1_IRQHandler()
+{
+  constexpr auto instance = Peripherals::Usart::UsartInstance::Usart1;
+  UsartType::GetInstance<instance>().HandleInterrupt(static_cast<uint8_t>(instance));
+}
+
+extern "C" void TIM2_IRQHandler()
+{
+  TimerType::GetInstance<Peripherals::Timer::TimerInstance::Tim2>().HandleInterrupt();
+}
+
+extern "C" void TIM3_IRQHandler()
+{
+  TimerType::GetInstance<Peripherals::Timer::TimerInstance::Tim3>().HandleInterrupt();
+}
+
+extern "C" void TIM4_IRQHandler()
+{
+  TimerType::GetInstance<Peripherals::Timer::TimerInstance::Tim4>().HandleInterrupt();
+}
+
+namespace
+{
+  /// @brief Cycle counter read by the handler of the latency probe.
+  constinit std::atomic<uint32_t> probeEntry {0};
+
+  /// @brief Vector of the last exception without handler, for the debugger.
+  constinit std::atomic<uint32_t> unusedVector {0};
+}  // namespace
+
+extern "C" void TAMPER_IRQHandler()
+{
+  probeEntry.store(Peripherals::Dwt::CycleCounter::Now(), std::memory_order_relaxed);
+}
+
+/// @brief Traps an exception or interrupt without handler, like the default handler of the startup file.
+extern "C" void UnusedVector_Handler()
+{
+  unusedVector.store(SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk, std::memory_order_relaxed);
+
+  for (;;)
+  {
+  }
 }
+
+#if defined(__arm__)
+extern "C" void SVC_Handler();
+extern "C" void PendSV_Handler();
+#endif
 // NOLINTEND
+
+namespace
+{
+  /// @brief Vectors of the application, the exceptions of the core without handler trap.
+  constexpr Peripherals::Vectors::VectorTable ApplicationVectors = {
+#if defined(__arm__)
+    {IRQn_Type::SVCall_IRQn, SVC_Handler},
+    {IRQn_Type::PendSV_IRQn, PendSV_Handler},
+#endif
+    {IRQn_Type::SysTick_IRQn, SysTick_Handler},
+    {IRQn_Type::TAMPER_IRQn, TAMPER_IRQHandler},
+    {IRQn_Type::RTC_IRQn, RTC_IRQHandler},
+    {IRQn_Type::EXTI0_IRQn, EXTI0_IRQHandler},
+    {IRQn_Type::EXTI1_IRQn, EXTI1_IRQHandler},
+    {IRQn_Type::EXTI2_IRQn, EXTI2_IRQHandler},
+    {IRQn_Type::EXTI3_IRQn, EXTI3_IRQHandler},
+    {IRQn_Type::EXTI4_IRQn, EXTI4_IRQHandler},
+    {IRQn_Type::EXTI9_5_IRQn, EXTI9_5_IRQHandler},
+    {IRQn_Type::TIM2_IRQn, TIM2_IRQHandler},
+    {IRQn_Type::TIM3_IRQn, TIM3_IRQHandler},
+    {IRQn_Type::TIM4_IRQn, TIM4_IRQHandler},
+    {IRQn_Type::USART1_IRQn, USART1_IRQHandler},
+    {IRQn_Type::EXTI15_10_IRQn, EXTI15_10_IRQHandler},
+    {IRQn_Type::RTC_Alarm_IRQn, RTC_Alarm_IRQHandler},
+  };
+
+  static_assert(std::ranges::all_of(InterruptManagerType::EnabledInterrupts,
+                  [](const IRQn_Type irq) { return ApplicationVectors.IsUsed(irq); }),
+    "An enabled interrupt has no vector");
+  static_assert(ApplicationVectors.IsUsed(InterruptManagerType::LatencyProbeInterrupt),
+    "The latency probe has no vector");
+  static_assert(ApplicationVectors.GetUsedInterrupts() == InterruptManagerType::EnabledInterrupts.size() + 1,
+    "A vector is bound to an interrupt which is never enabled");
+
+#if defined(__arm__)
+  /// @brief Measures the entry latency of the probe interrupt with the active vector table.
+  /// @return Shortest latency of several measurements in core clock cycles.
+  uint32_t MeasureProbeLatency()
+  {
+    constexpr auto repetitions = 8;
+    auto shortest = UINT32_MAX;
+
+    for (auto i = 0; i < repetitions; ++i)
+    {
+      const auto start = Peripherals::Dwt::CycleCounter::Now();
+      NVIC_SetPendingIRQ(InterruptManagerType::LatencyProbeInterrupt);
+
+      // The interrupt is taken at the latest once the barriers completed
+      Peripherals::Cpu::DataSynchronizationBarrier();
+      Peripherals::Cpu::InstructionSynchronizationBarrier();
+
+      shortest = std::min<uint32_t>(shortest, probeEntry.load(std::memory_order_relaxed) - start);
+    }
+
+    return shortest;
+  }
+#endif
+}  // namespace
+
+namespace Peripherals
+{
+  void InterruptManager::RelocateVectorTable()
+  {
+    Vectors::ramVectorTable.Load(ApplicationVectors, UnusedVector_Handler);
+    Vectors::ramVectorTable.Activate();
+  }
+
+  EntryLatency InterruptManager::MeasureEntryLatency()
+  {
+#if defined(__arm__)
+    const auto ramTable = SCB->VTOR;
+
+    NVIC_EnableIRQ(LatencyProbeInterrupt);
+
+    SCB->VTOR = FLASH_BASE;
+    Cpu::DataSynchronizationBarrier();
+    const auto flash = MeasureProbeLatency();
+
+    SCB->VTOR = ramTable;
+    Cpu::DataSynchronizationBarrier();
+    const auto ram = MeasureProbeLatency();
+
+    NVIC_DisableIRQ(LatencyProbeInterrupt);
+
+    return EntryLatency {
+      .flash = flash,
+      .ram = ram,
+    };
+#else
+    // The NVIC functions issue barrier instructions, which do not exist on the host
+    return EntryLatency {
+      .flash = 0,
+      .ram = 0,
+    };
+#endif
+  }
+}  // namespace Peripherals
@@ -4,63 +4,255 @@
 /// @version 1.0
 /// @brief Reset and Clock Control (RCC) implementation file.
 
+#include <ClockSwitch.hpp>
+#include <Cpu.hpp>
+#include <CriticalSection.hpp>
+#include <Dwt.hpp>
 #include <Rcc.hpp>
+#include <Timebase.hpp>
+#include <algorithm>
+#include <cstdint>
+
+namespace Cpu = Peripherals::Cpu;
 
 using RccType = Peripherals::Rcc::ResetAndClockControl;
 
-RccType::ResetAndClockControl() : sysTick {0}
+constinit RccType RccType::instance {};
+
+void RccType::Init()
 {
   ConfigureClocks();
+  profile = ClockProfile::High;
   ConfigureSysTick();
+
+  // The busy waiting delays count core clock cycles
+  Peripherals::Dwt::CycleCounter::Enable();
+}
+
+void RccType::StartOscillators()
+{
+  if constexpr (UsesHse(Clocks))
+  {
+    RCC->CR |= RCC_CR_HSEON;
+  }
 }
 
-void RccType::Delay(const uint32_t milliseconds) const
+void RccType::Delay(const uint32_t milliseconds)
 {
   const auto start = GetSysTick();
 
   while ((GetSysTick() - start) < milliseconds)
   {
-    __NOP();
+    Idle(start + milliseconds);
   }
 }
 
-void RccType::ConfigureClocks()
+void RccType::Idle(const uint32_t deadline, const WakeCheck pending, void* context)
+{
+  // The profile is read under the lock, a thread switching the clock cannot preempt the sleep once it is chosen
+  const Peripherals::PrimaskLock lock;
+
+  if ((pending != nullptr) && pending(context))
+  {
+    return;
+  }
+
+  if (profile == ClockProfile::High)
+  {
+    Sleep<ClockProfile::High>(deadline);
+  }
+  else
+  {
+    Sleep<ClockProfile::Low>(deadline);
+  }
+}
+
+template<Peripherals::Rcc::ClockProfile Profile>
+void RccType::Sleep(const uint32_t deadline)
+{
+  constexpr auto profileTicks = GetTicks(Profile);
+
+  const auto idleTicks = static_cast<int32_t>(deadline - GetSysTick());
+
+  if (idleTicks <= 0)
+  {
+    return;
+  }
+
+  // Stop the timer, reading the control register clears a stale count flag. If a tick is already pending, its
+  // interrupt has to run first. A value of zero means the timer is about to reload, so the remainder of the current
+  // tick is unknown.
+  const auto control = SysTick->CTRL & ~SysTick_CTRL_COUNTFLAG_Msk;
+  SysTick->CTRL = control & ~SysTick_CTRL_ENABLE_Msk;
+
+  if (((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0) || (SysTick->VAL == 0))
+  {
+    SysTick->CTRL = control | SysTick_CTRL_ENABLE_Msk;
+    return;
+  }
+
+  const auto plan = TickSuppressionType<Profile>::Plan(static_cast<uint32_t>(idleTicks), SysTick->VAL);
+  SysTick->LOAD = plan.reload;
+  SysTick->VAL = 0x00UL;
+  SysTick->CTRL = control | SysTick_CTRL_ENABLE_Msk;
+
+  // Interrupts are masked, so the core wakes up on any pending interrupt without entering its handler yet
+  Cpu::DataSynchronizationBarrier();
+  Cpu::WaitForInterrupt();
+  Cpu::InstructionSynchronizationBarrier();
+
+  const auto wakeControl = SysTick->CTRL;
+  SysTick->CTRL = wakeControl & ~SysTick_CTRL_ENABLE_Msk;
+  const auto expired = (wakeControl & SysTick_CTRL_COUNTFLAG_Msk) != 0;
+  const auto result = TickSuppressionType<Profile>::Resume(plan, expired, SysTick->VAL);
+
+  // Restart the periodic tick aligned to the next tick boundary, the new reload applies after the first expiry
+  SysTick->LOAD = std::max<uint32_t>(result.cyclesToNextTick, 2) - 1;
+  SysTick->VAL = 0x00UL;
+  SysTick->CTRL = control | SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = profileTicks - 1;
+
+  sysTick.Advance(result.tickCompensation);
+  idleResidency.Record(GetSysTick(), result.sleptCycles * (Ticks / profileTicks));
+}
+
+void RccType::SetSystemClock(const ClockProfile target)
+{
+  if (target == profile)
+  {
+    return;
+  }
+
+  const auto start = Now();
+  const auto& previous = GetClocks();
+  const auto& current = Profiles[static_cast<std::size_t>(target)];
+  auto clockSwitch = ClockSwitch(*RCC, *FLASH);
+
+  NotifyClockListeners(ClockChange::Pending, previous, current);
+  clockSwitch.Prepare(previous, current);
+
+  // The SysTick timer runs with the core clock, the remainder of the tick in progress is converted to the new clock.
+  // A pending tick interrupt runs after the switch and still counts the tick.
+  {
+    const Peripherals::PrimaskLock lock;
+
+    const auto control = SysTick->CTRL & ~SysTick_CTRL_COUNTFLAG_Msk;
+    SysTick->CTRL = control & ~SysTick_CTRL_ENABLE_Msk;
+    const auto remaining = Time::ConvertTickValue(SysTick->VAL, GetTicks(profile), GetTicks(target));
+
+    clockSwitch.Select(current);
+
+    // The first reload ends the tick in progress, the new reload applies after its expiry
+    SysTick->LOAD = std::max<uint32_t>(remaining, 2) - 1;
+    SysTick->VAL = 0x00UL;
+    SysTick->CTRL = control | SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = GetTicks(target) - 1;
+
+    profile = target;
+    clockSwitches = clockSwitches + 1;
+  }
+
+  clockSwitch.Finish(previous, current);
+  NotifyClockListeners(ClockChange::Completed, previous, current);
+
+  const auto latency = static_cast<uint32_t>(Now() - start);
+  ++clockSwitchStatistics.switches;
+  clockSwitchStatistics.lastLatency = latency;
+  clockSwitchStatistics.maxLatency = std::max(clockSwitchStatistics.maxLatency, latency);
+}
+
+bool RccType::EnterStop(const WakeCheck pending, void* context)
 {
-  RCC->CFGR &= ~RCC_CFGR_PLLMULL;
-  RCC->CFGR |= RCC_CFGR_PLLMULL9;
-  RCC->CFGR &= ~RCC_CFGR_USBPRE;
+  const auto& clocks = GetClocks();
+  NotifyClockListeners(ClockChange::Pending, clocks, clocks);
 
-  RCC->CR |= RCC_CR_HSEON;
-  while ((RCC->CR & RCC_CR_HSERDY) == 0)
+  // As for the tickless sleep, a due tick has to be counted by its interrupt first
+  Cpu::DisableInterrupts();
+
+  stopControl = SysTick->CTRL & ~SysTick_CTRL_COUNTFLAG_Msk;
+  SysTick->CTRL = stopControl & ~SysTick_CTRL_ENABLE_Msk;
+  stopValue = SysTick->VAL;
+
+  if (((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0) || (stopValue == 0) || ((pending != nullptr) && pending(context)))
   {
-    __NOP();
+    SysTick->CTRL = stopControl | SysTick_CTRL_ENABLE_Msk;
+    Cpu::EnableInterrupts();
+    NotifyClockListeners(ClockChange::Completed, clocks, clocks);
+    return false;
   }
 
-  RCC->CFGR |= RCC_CFGR_PLLSRC;
+  return true;
+}
+
+uint32_t RccType::RestoreClocks()
+{
+  const auto& clocks = GetClocks();
+  auto clockSwitch = ClockSwitch(*RCC, *FLASH);
+  const auto start = Peripherals::Dwt::CycleCounter::Now();
 
-  RCC->CR |= RCC_CR_PLLON;
-  while ((RCC->CR & RCC_CR_PLLRDY) == 0)
+  clockSwitch.Prepare(ResetClockConfig, clocks);
+  const auto switched = Peripherals::Dwt::CycleCounter::Now();
+
+  // The few cycles of the switch itself before the source changes are counted at the system clock
+  clockSwitch.Select(clocks);
+  clockSwitch.Finish(ResetClockConfig, clocks);
+  const auto end = Peripherals::Dwt::CycleCounter::Now();
+
+  return ((switched - start) / (HsiFrequency / 1'000'000)) + ((end - switched) / (clocks.systemClock / 1'000'000));
+}
+
+void RccType::LeaveStop(const uint64_t elapsedCycles)
+{
+  const auto profileTicks = GetTicks(profile);
+  const auto progress = Power::AdvanceStoppedTick(stopValue, elapsedCycles / (Ticks / profileTicks), profileTicks);
+
+  // The first reload ends the tick in progress, the periodic reload applies after its expiry
+  SysTick->LOAD = std::max<uint32_t>(progress.cyclesToNextTick, 2) - 1;
+  SysTick->VAL = 0x00UL;
+  SysTick->CTRL = stopControl | SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = profileTicks - 1;
+
+  sysTick.Advance(progress.completedTicks);
+
+  Cpu::EnableInterrupts();
+
+  const auto& clocks = GetClocks();
+  NotifyClockListeners(ClockChange::Completed, clocks, clocks);
+}
+
+bool RccType::AddClockListener(const ClockListener listener, void* context)
+{
+  for (auto& entry : clockListeners)
   {
-    __NOP();
+    if (entry.listener == nullptr)
+    {
+      entry = ClockListenerEntry {.listener = listener, .context = context};
+      return true;
+    }
   }
 
-  FLASH->ACR &= ~FLASH_ACR_LATENCY;
-  FLASH->ACR |= FLASH_ACR_LATENCY_1;
-  FLASH->ACR |= FLASH_ACR_PRFTBE;
+  return false;
+}
 
-  RCC->CFGR &= ~RCC_CFGR_SW;
-  RCC->CFGR |= RCC_CFGR_SW_PLL;
-  while ((RCC->CFGR & RCC_CFGR_SWS_PLL) == 0)
+void RccType::NotifyClockListeners(
+  const ClockChange change, const ClockConfig& previous, const ClockConfig& current) const
+{
+  for (const auto& entry : clockListeners)
   {
-    __NOP();
+    if (entry.listener != nullptr)
+    {
+      entry.listener(entry.context, change, previous, current);
+    }
   }
+}
+
+void RccType::ConfigureClocks()
+{
+  auto clockSwitch = ClockSwitch(*RCC, *FLASH);
 
-  RCC->CFGR &= ~RCC_CFGR_HPRE;
-  RCC->CFGR &= ~RCC_CFGR_PPRE1;
-  RCC->CFGR |= RCC_CFGR_PPRE1_2;
-  RCC->CFGR &= ~RCC_CFGR_PPRE2;
-  RCC->CFGR &= ~RCC_CFGR_ADCPRE;
-  RCC->CFGR |= RCC_CFGR_ADCPRE_1;
+  clockSwitch.Prepare(ResetClockConfig, Clocks);
+  clockSwitch.Select(Clocks);
+  clockSwitch.Finish(ResetClockConfig, Clocks);
 }
 
 void RccType::ConfigureSysTick()
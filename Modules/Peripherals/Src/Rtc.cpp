@@ -0,0 +1,239 @@
+/// @file Rtc.cpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Real time clock implementation file.
+
+#include <stm32f1xx.h>
+
+#include <Rtc.hpp>
+#include <algorithm>
+#include <cstdint>
+
+using RtcType = Peripherals::Rtc::RealTimeClock;
+
+constinit RtcType RtcType::instance {};
+
+namespace
+{
+  /// @brief Flags of the control register which are cleared by writing zero.
+  constexpr uint32_t ClearableFlags = RTC_CRL_SECF | RTC_CRL_ALRF | RTC_CRL_OWF | RTC_CRL_RSF;
+
+  static_assert(RTC_CRH_SECIE == RTC_CRL_SECF && RTC_CRH_ALRIE == RTC_CRL_ALRF,
+    "The interrupt enable bits are expected at the positions of their flags");
+
+  /// @brief Clears flags of the control register, the others are written as one and keep their state.
+  /// @param flags Flags to clear.
+  void ClearFlags(const uint32_t flags)
+  {
+    RTC->CRL = ClearableFlags & ~flags;
+  }
+}  // namespace
+
+void RtcType::Init()
+{
+  if (initialized)
+  {
+    return;
+  }
+
+  RCC->APB1ENR |= RCC_APB1ENR_PWREN | RCC_APB1ENR_BKPEN;
+  PWR->CR |= PWR_CR_DBP;
+
+  if (BKP->DR1 != ConfiguredMarker)
+  {
+    ConfigureBackupDomain();
+  }
+
+  // The register interface was reset with the core, the counter can only be read once it is synchronized again
+  Resynchronize();
+
+  // The alarm reaches the EXTI as rising edge, which wakes the core from Stop mode
+  EXTI->RTSR |= EXTI_RTSR_TR17;
+  EXTI->IMR |= EXTI_IMR_MR17;
+
+  initialized = true;
+}
+
+void RtcType::Resynchronize()
+{
+  ClearFlags(RTC_CRL_RSF);
+  while ((RTC->CRL & RTC_CRL_RSF) == 0)
+  {
+    __NOP();
+  }
+}
+
+uint32_t RtcType::GetCounter() const
+{
+  for (;;)
+  {
+    const auto high = RTC->CNTH & 0xFFFFU;
+    const auto low = RTC->CNTL & 0xFFFFU;
+
+    if (high == (RTC->CNTH & 0xFFFFU))
+    {
+      return (high << 16U) | low;
+    }
+  }
+}
+
+uint64_t RtcType::GetPreciseCounter() const
+{
+  for (;;)
+  {
+    const auto counter = GetCounter();
+    const auto divider = ((RTC->DIVH & 0x000FU) << 16U) | (RTC->DIVL & 0xFFFFU);
+
+    if (counter == GetCounter())
+    {
+      return (static_cast<uint64_t>(counter) * Rcc::LseFrequency) + Prescaler - std::min(divider, Prescaler);
+    }
+  }
+}
+
+void RtcType::SetCounter(const uint32_t counter)
+{
+  EnterConfiguration();
+  RTC->CNTH = counter >> 16U;
+  RTC->CNTL = counter & 0xFFFFU;
+  ExitConfiguration();
+}
+
+void RtcType::SetSecondCallback(const Callback callback, void* context)
+{
+  RTC->CRH &= ~RTC_CRH_SECIE;
+  secondCallback = callback;
+  secondContext = context;
+
+  if (callback != nullptr)
+  {
+    ClearFlags(RTC_CRL_SECF);
+    RTC->CRH |= RTC_CRH_SECIE;
+  }
+}
+
+void RtcType::SetAlarm(const uint32_t counter, const Callback callback, void* context)
+{
+  alarm = counter;
+  alarmCallback = callback;
+  alarmContext = context;
+  UpdateAlarm();
+}
+
+void RtcType::CancelAlarm()
+{
+  alarmCallback = nullptr;
+  UpdateAlarm();
+}
+
+void RtcType::SetWakeup(const uint32_t counter)
+{
+  wakeup = counter;
+  wakeupSet = true;
+  UpdateAlarm();
+}
+
+void RtcType::ClearWakeup()
+{
+  wakeupSet = false;
+
+  // An expired application alarm is left to the interrupt, which programs the alarm register afterwards
+  if (alarmCallback != nullptr && GetCounter() >= alarm)
+  {
+    return;
+  }
+
+  UpdateAlarm();
+}
+
+void RtcType::HandleInterrupt()
+{
+  const auto flags = RTC->CRL & RTC->CRH & (RTC_CRL_SECF | RTC_CRL_ALRF);
+  ClearFlags(flags);
+
+  const auto counter = GetCounter();
+
+  if ((flags & RTC_CRL_SECF) != 0 && secondCallback != nullptr)
+  {
+    secondCallback(secondContext, counter);
+  }
+
+  // The alarm register may hold the earlier wakeup alarm, which is handled by the power manager
+  if ((flags & RTC_CRL_ALRF) != 0 && alarmCallback != nullptr && counter >= alarm)
+  {
+    // The alarm fires once, the callback may set the next one
+    const auto callback = alarmCallback;
+    alarmCallback = nullptr;
+    UpdateAlarm();
+    callback(alarmContext, counter);
+  }
+}
+
+void RtcType::HandleAlarmInterrupt()
+{
+  EXTI->PR = EXTI_PR_PR17;
+}
+
+void RtcType::ConfigureBackupDomain()
+{
+  RCC->BDCR |= RCC_BDCR_BDRST;
+  RCC->BDCR &= ~RCC_BDCR_BDRST;
+
+  RCC->BDCR |= RCC_BDCR_LSEON;
+  while ((RCC->BDCR & RCC_BDCR_LSERDY) == 0)
+  {
+    __NOP();
+  }
+
+  RCC->BDCR |= RCC_BDCR_RTCSEL_LSE | RCC_BDCR_RTCEN;
+
+  EnterConfiguration();
+  RTC->PRLH = Prescaler >> 16U;
+  RTC->PRLL = Prescaler & 0xFFFFU;
+  RTC->CNTH = 0;
+  RTC->CNTL = 0;
+  ExitConfiguration();
+
+  BKP->DR1 = ConfiguredMarker;
+}
+
+void RtcType::EnterConfiguration()
+{
+  while ((RTC->CRL & RTC_CRL_RTOFF) == 0)
+  {
+    __NOP();
+  }
+
+  RTC->CRL = ClearableFlags | RTC_CRL_CNF;
+}
+
+void RtcType::ExitConfiguration()
+{
+  RTC->CRL = ClearableFlags;
+
+  while ((RTC->CRL & RTC_CRL_RTOFF) == 0)
+  {
+    __NOP();
+  }
+}
+
+void RtcType::UpdateAlarm() const
+{
+  RTC->CRH &= ~RTC_CRH_ALRIE;
+
+  if (alarmCallback == nullptr && !wakeupSet)
+  {
+    return;
+  }
+
+  const auto counter = (alarmCallback == nullptr) ? wakeup : (wakeupSet ? std::min(alarm, wakeup) : alarm);
+
+  EnterConfiguration();
+  RTC->ALRH = counter >> 16U;
+  RTC->ALRL = counter & 0xFFFFU;
+  ExitConfiguration();
+
+  ClearFlags(RTC_CRL_ALRF);
+  RTC->CRH |= RTC_CRH_ALRIE;
+}
@@ -0,0 +1,230 @@
+/// @file Timer.cpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief General purpose timer implementation file.
+
+#include <stm32f1xx.h>
+
+#include <Timer.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+using TimerType = Peripherals::Timer::Timer;
+
+constinit std::array<TimerType, TimerType::InstanceCount> TimerType::instances {};
+
+namespace
+{
+  /// @brief Output compare mode frozen, the match only sets the flag without driving the pin.
+  constexpr uint32_t FrozenCompareMode = 0;
+
+  /// @brief Input capture mode on the own input pin without prescaler and filter.
+  constexpr uint32_t DirectCaptureMode = TIM_CCMR1_CC1S_0;
+
+  /// @brief Returns the index of a channel.
+  constexpr uint32_t GetIndex(const Peripherals::Timer::Channel channel)
+  {
+    return static_cast<uint32_t>(channel);
+  }
+
+  /// @brief Returns the interrupt enable and flag bit of a channel, identical in DIER and SR.
+  constexpr uint32_t GetInterruptMask(const Peripherals::Timer::Channel channel)
+  {
+    return TIM_DIER_CC1IE << GetIndex(channel);
+  }
+
+  /// @brief Returns the shift of a channel in the capture compare enable register.
+  constexpr uint32_t GetEnableShift(const Peripherals::Timer::Channel channel)
+  {
+    return 4U * GetIndex(channel);
+  }
+}  // namespace
+
+void TimerType::Configure(TIM_TypeDef* peripheral, const uint16_t prescaler)
+{
+  // Only a configured timer can be rescaled, so the listener is registered with the first configuration
+  if (this->peripheral == nullptr)
+  {
+    Peripherals::Rcc::ResetAndClockControl::GetInstance().AddClockListener(HandleClockChange, this);
+  }
+
+  this->peripheral = peripheral;
+  channels = {};
+
+  ConfigureClocks();
+
+  // Up counting over the full 16 bit range, only counter overflows generate update events
+  peripheral->CR1 = TIM_CR1_URS;
+  peripheral->DIER = 0;
+  peripheral->CCER = 0;
+  peripheral->CCMR1 = 0;
+  peripheral->CCMR2 = 0;
+  peripheral->PSC = prescaler;
+  peripheral->ARR = 0xFFFFU;
+
+  // The prescaler is buffered, the update event loads it
+  peripheral->EGR = TIM_EGR_UG;
+  peripheral->SR = 0;
+  peripheral->CR1 |= TIM_CR1_CEN;
+}
+
+void TimerType::StartOneShot(const Channel channel, const uint16_t delay, const Callback callback, void* context)
+{
+  StartCompare(channel,
+    ChannelState {.mode = ChannelMode::OneShot, .callback = callback, .context = context, .period = 0},
+    delay);
+}
+
+void TimerType::StartPeriodic(const Channel channel, const uint16_t period, const Callback callback, void* context)
+{
+  StartCompare(channel,
+    ChannelState {.mode = ChannelMode::Periodic, .callback = callback, .context = context, .period = period},
+    period);
+}
+
+void TimerType::StartCapture(const Channel channel, const Edge edge, const Callback callback, void* context)
+{
+  Stop(channel);
+  channels[GetIndex(channel)] =
+    ChannelState {.mode = ChannelMode::Capture, .callback = callback, .context = context, .period = 0};
+
+  // The channel direction can only be changed while the channel is disabled
+  SetChannelMode(channel, DirectCaptureMode);
+
+  const auto polarity = (edge == Edge::Falling) ? TIM_CCER_CC1P : 0U;
+  peripheral->CCER |= (TIM_CCER_CC1E | polarity) << GetEnableShift(channel);
+  peripheral->SR = ~GetInterruptMask(channel);
+  peripheral->DIER |= GetInterruptMask(channel);
+}
+
+void TimerType::Stop(const Channel channel)
+{
+  peripheral->DIER &= ~GetInterruptMask(channel);
+  peripheral->CCER &= ~((TIM_CCER_CC1E | TIM_CCER_CC1P) << GetEnableShift(channel));
+  channels[GetIndex(channel)] = ChannelState {};
+}
+
+void TimerType::HandleInterrupt()
+{
+  const auto flags = peripheral->SR & peripheral->DIER;
+
+  for (uint32_t index = 0; index < ChannelCount; ++index)
+  {
+    const auto channel = static_cast<Channel>(index);
+    const auto mask = GetInterruptMask(channel);
+
+    if ((flags & mask) == 0)
+    {
+      continue;
+    }
+
+    // The flags are cleared by writing zero, writing one has no effect. Reading the capture register of a capture
+    // channel clears its flag as well.
+    peripheral->SR = ~mask;
+    auto& compare = GetCompareRegister(channel);
+    const auto value = static_cast<uint16_t>(compare);
+    const auto state = channels[index];
+
+    if (state.mode == ChannelMode::Periodic)
+    {
+      compare = static_cast<uint16_t>(value + state.period);
+    }
+    else if (state.mode == ChannelMode::OneShot)
+    {
+      Stop(channel);
+    }
+
+    if (state.callback != nullptr)
+    {
+      state.callback(state.context, value);
+    }
+  }
+}
+
+void TimerType::HandleClockChange(void* context,
+  const Peripherals::Rcc::ClockChange change,
+  const Peripherals::Rcc::ClockConfig& previous,
+  const Peripherals::Rcc::ClockConfig& current)
+{
+  if (change == Peripherals::Rcc::ClockChange::Completed && previous.apb1TimerClock != current.apb1TimerClock)
+  {
+    static_cast<TimerType*>(context)->Rescale(previous.apb1TimerClock, current.apb1TimerClock);
+  }
+}
+
+void TimerType::Rescale(const uint32_t previousClock, const uint32_t clock)
+{
+  const auto previousDivider = static_cast<uint64_t>(peripheral->PSC) + 1;
+  const auto scaled = ((previousDivider * clock) + (previousClock / 2)) / previousClock;
+  const auto divider = std::clamp<uint64_t>(scaled, 1, 0x10000U);
+  const auto counter = GetCounter();
+
+  // The update event loads the buffered prescaler and restarts the counter, without an interrupt due to URS
+  peripheral->PSC = static_cast<uint32_t>(divider - 1);
+  peripheral->EGR = TIM_EGR_UG;
+
+  for (uint32_t index = 0; index < ChannelCount; ++index)
+  {
+    const auto mode = channels[index].mode;
+
+    if (mode == ChannelMode::OneShot || mode == ChannelMode::Periodic)
+    {
+      auto& compare = GetCompareRegister(static_cast<Channel>(index));
+      compare = static_cast<uint16_t>(compare - counter);
+    }
+  }
+}
+
+void TimerType::StartCompare(const Channel channel, const ChannelState& state, const uint16_t delay)
+{
+  Stop(channel);
+  channels[GetIndex(channel)] = state;
+
+  SetChannelMode(channel, FrozenCompareMode);
+  GetCompareRegister(channel) = static_cast<uint16_t>(GetCounter() + delay);
+  peripheral->SR = ~GetInterruptMask(channel);
+  peripheral->DIER |= GetInterruptMask(channel);
+}
+
+volatile uint32_t& TimerType::GetCompareRegister(const Channel channel) const
+{
+  switch (channel)
+  {
+    case Channel::Channel1:
+      return peripheral->CCR1;
+    case Channel::Channel2:
+      return peripheral->CCR2;
+    case Channel::Channel3:
+      return peripheral->CCR3;
+    case Channel::Channel4:
+    default:
+      return peripheral->CCR4;
+  }
+}
+
+void TimerType::SetChannelMode(const Channel channel, const uint32_t mode) const
+{
+  constexpr uint32_t channelModeMask = 0xFFU;
+  auto& modeRegister = (GetIndex(channel) < 2) ? peripheral->CCMR1 : peripheral->CCMR2;
+  const auto shift = 8U * (GetIndex(channel) % 2);
+
+  modeRegister = (modeRegister & ~(channelModeMask << shift)) | (mode << shift);
+}
+
+void TimerType::ConfigureClocks() const
+{
+  if (peripheral == TIM2)
+  {
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+  }
+  else if (peripheral == TIM3)
+  {
+    RCC->APB1ENR |= RCC_APB1ENR_TIM3EN;
+  }
+  else if (peripheral == TIM4)
+  {
+    RCC->APB1ENR |= RCC_APB1ENR_TIM4EN;
+  }
+}
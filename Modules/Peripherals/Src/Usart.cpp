@@ -9,6 +9,7 @@
 #include <Peripherals.hpp>
 #include <Rcc.hpp>
 #include <Usart.hpp>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <span>
@@ -17,16 +18,75 @@
 using RccType = Peripherals::Rcc::ResetAndClockControl;
 using UsartType = Peripherals::Usart::UniversalSynchronousAsynchronousReceiverTransmitter;
 
+constinit std::array<UsartType, UsartType::InstanceCount> UsartType::instances {};
+
 void UsartType::Configure(USART_TypeDef* peripheral, const std::pair<size_t, size_t> mantissaFraction)
 {
   this->peripheral = peripheral;
   this->mantissa = mantissaFraction.first;
   this->fraction = mantissaFraction.second;
+  this->configuredClock = 0;
 
   ConfigureClocks();
   ConfigureUsart();
 }
 
+void UsartType::EnableReceiver() const
+{
+  peripheral->CR1 |= USART_CR1_RE | USART_CR1_RXNEIE;
+}
+
+void UsartType::HandleInterrupt(const uint8_t source) const
+{
+  // Reading the data register after the status register also clears the overrun and noise flags
+  const auto status = peripheral->SR;
+  const auto data = static_cast<uint16_t>(peripheral->DR & USART_DR_DR);
+
+  if ((status & USART_SR_RXNE) != 0)
+  {
+    Events::Post(Events::Event {
+      .type = Events::EventType::CharacterReceived,
+      .source = source,
+      .data = data,
+    });
+  }
+}
+
+void UsartType::HandleClockChange(void* context,
+  const Peripherals::Rcc::ClockChange change,
+  const Peripherals::Rcc::ClockConfig& previous,
+  const Peripherals::Rcc::ClockConfig& current)
+{
+  auto& usart = *static_cast<UsartType*>(context);
+  auto* const peripheral = usart.peripheral;
+
+  if (change == Peripherals::Rcc::ClockChange::Pending)
+  {
+    // A character shifted out while the clock changes would be garbled
+    while (((peripheral->CR1 & USART_CR1_TE) != 0) && ((peripheral->SR & USART_SR_TC) == 0))
+    {
+    }
+
+    return;
+  }
+
+  // USART1 is connected to APB2, the others to APB1
+  const auto previousClock = (peripheral == USART1) ? previous.apb2Clock : previous.apb1Clock;
+  const auto clock = (peripheral == USART1) ? current.apb2Clock : current.apb1Clock;
+
+  // The configured divider is always scaled from the clock it was computed for, so rounding errors do not add up
+  if (usart.configuredClock == 0)
+  {
+    usart.configuredClock = previousClock;
+  }
+
+  // The divider in sixteenths of the bus clock per bit scales with the clock, rounded to the closest baud rate
+  const auto divider = (usart.mantissa << USART_BRR_DIV_Mantissa_Pos) | usart.fraction;
+  const auto scaled = ((static_cast<uint64_t>(divider) * clock) + (usart.configuredClock / 2)) / usart.configuredClock;
+
+  peripheral->BRR = static_cast<uint32_t>(scaled);
+}
+
 template<class T, std::size_t N>
 Peripherals::Status UsartType::Transmit(const std::span<T, N>& data, const size_t timeout) const
 {
@@ -0,0 +1,232 @@
+/// @file PowerManager.cpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Power manager implementation file.
+
+#include <stm32f1xx.h>
+
+#include <Cpu.hpp>
+#include <CriticalSection.hpp>
+#include <PowerManager.hpp>
+#include <Rcc.hpp>
+#include <Rtc.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace Cpu = Peripherals::Cpu;
+
+using PowerManagerType = Power::PowerManager;
+using RccType = Peripherals::Rcc::ResetAndClockControl;
+using RtcType = Peripherals::Rtc::RealTimeClock;
+
+constinit PowerManagerType PowerManagerType::instance {};
+
+namespace
+{
+  /// @brief Returns the backup registers holding the retained state, DR1 is used by the RTC driver.
+  /// @return First of the consecutive data registers.
+  volatile uint32_t* GetRetainedRegisters()
+  {
+    return &BKP->DR2;
+  }
+
+  /// @brief Reads the retained state from the backup registers.
+  /// @return Register values.
+  std::array<uint16_t, Power::RetainedState::WordCount> ReadRetained()
+  {
+    std::array<uint16_t, Power::RetainedState::WordCount> words {};
+    auto* const registers = GetRetainedRegisters();
+
+    for (std::size_t index = 0; index < words.size(); ++index)
+    {
+      words[index] = static_cast<uint16_t>(registers[index]);
+    }
+
+    return words;
+  }
+
+  /// @brief Writes the retained state to the backup registers.
+  /// @param words Register values.
+  void WriteRetained(const std::array<uint16_t, Power::RetainedState::WordCount>& words)
+  {
+    auto* const registers = GetRetainedRegisters();
+
+    for (std::size_t index = 0; index < words.size(); ++index)
+    {
+      registers[index] = words[index];
+    }
+  }
+
+  /// @brief Sleeps deeply, the power down bit selects between Stop and Standby.
+  void WaitForInterruptDeeply()
+  {
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    Cpu::DataSynchronizationBarrier();
+    Cpu::WaitForInterrupt();
+    Cpu::InstructionSynchronizationBarrier();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+  }
+}  // namespace
+
+void PowerManagerType::Init()
+{
+  auto& rcc = RccType::GetInstance();
+  RtcType::GetInstance().Init();
+
+  if ((PWR->CSR & PWR_CSR_SBF) != 0)
+  {
+    if (const auto state = RetainedState::Unpack(ReadRetained()))
+    {
+      retained = *state;
+      retained.standbySeconds += RtcType::GetInstance().GetCounter() - retained.standbyStart;
+
+      if (retained.clockProfile == static_cast<uint8_t>(Peripherals::Rcc::ClockProfile::Low))
+      {
+        rcc.SetSystemClock(Peripherals::Rcc::ClockProfile::Low);
+      }
+    }
+
+    PWR->CR |= PWR_CR_CSBF;
+  }
+
+  // The push button on the WKUP pin is only needed to leave Standby
+  PWR->CSR &= ~PWR_CSR_EWUP;
+  PWR->CR |= PWR_CR_CWUF;
+
+  runStart = rcc.Now();
+}
+
+void PowerManagerType::Idle(const uint32_t deadline, const Peripherals::Rcc::WakeCheck pending, void* context)
+{
+  auto& rcc = RccType::GetInstance();
+  const auto idleStart = rcc.Now();
+  residency.Record(PowerState::Run, idleStart - runStart);
+
+  const auto idleTicks = static_cast<int32_t>(deadline - rcc.GetSysTick());
+  auto state = (idleTicks > 0) ? policy.Select(static_cast<uint32_t>(idleTicks)) : PowerState::Run;
+
+  if (state == PowerState::Standby)
+  {
+    Standby(static_cast<uint32_t>(idleTicks), pending, context);
+    state = PowerState::Stop;
+  }
+
+  if (state == PowerState::Stop && !Stop(static_cast<uint32_t>(idleTicks), pending, context))
+  {
+    state = PowerState::Sleep;
+  }
+
+  if (state == PowerState::Sleep)
+  {
+    rcc.Idle(deadline, pending, context);
+  }
+
+  runStart = rcc.Now();
+
+  if (state != PowerState::Run)
+  {
+    residency.Record(state, runStart - idleStart);
+  }
+}
+
+bool PowerManagerType::Stop(const uint32_t idleTicks, const Peripherals::Rcc::WakeCheck pending, void* context)
+{
+  auto& rcc = RccType::GetInstance();
+  auto& rtc = RtcType::GetInstance();
+
+  // The alarm expires at the start of a second, the last one before the deadline is taken
+  const auto now = rtc.GetPreciseCounter();
+  const auto wakeup = (now + ((static_cast<uint64_t>(idleTicks) * Peripherals::Rcc::LseFrequency) / 1000)) /
+                      Peripherals::Rcc::LseFrequency;
+
+  if (wakeup * Peripherals::Rcc::LseFrequency < now + MinimumStopCycles || !rcc.EnterStop(pending, context))
+  {
+    return false;
+  }
+
+  rtc.SetWakeup(static_cast<uint32_t>(wakeup));
+  const auto start = rtc.GetPreciseCounter();
+
+  // Stop mode with the voltage regulator in low power mode
+  PWR->CR = (PWR->CR & ~PWR_CR_PDDS) | PWR_CR_LPDS | PWR_CR_CWUF;
+  WaitForInterruptDeeply();
+
+  // The core runs from the internal oscillator until the clocks are restored
+  const auto latency = rcc.RestoreClocks();
+
+  // The register interface of the RTC was stopped as well
+  RtcType::Resynchronize();
+  const auto end = rtc.GetPreciseCounter();
+  rtc.ClearWakeup();
+
+  rcc.LeaveStop(((end - start) * RccType::Ticks * 1000) / Peripherals::Rcc::LseFrequency);
+
+  wakeupStatistics.lastLatency = latency;
+  wakeupStatistics.maxLatency = std::max(wakeupStatistics.maxLatency, latency);
+
+  return true;
+}
+
+void PowerManagerType::Standby(const uint32_t idleTicks, const Peripherals::Rcc::WakeCheck pending, void* context)
+{
+  auto& rtc = RtcType::GetInstance();
+  const auto now = rtc.GetCounter();
+  const auto wakeup = now + (idleTicks / 1000);
+
+  if (wakeup <= now + 1)
+  {
+    return;
+  }
+
+  ++retained.standbyEntries;
+  retained.standbyStart = now;
+  retained.clockProfile = static_cast<uint8_t>(RccType::GetInstance().GetClockProfile());
+  WriteRetained(retained.Pack());
+
+  // Masked by PRIMASK, the core still wakes up on a pending interrupt but does not enter its handler
+  const Peripherals::PrimaskLock lock;
+
+  if ((pending != nullptr) && pending(context))
+  {
+    return;
+  }
+
+  rtc.SetWakeup(wakeup);
+
+  // The push button on PA0 is the WKUP pin, the wakeup flag has to be cleared or the core wakes up at once
+  PWR->CSR |= PWR_CSR_EWUP;
+  PWR->CR |= PWR_CR_PDDS | PWR_CR_CWUF;
+  WaitForInterruptDeeply();
+
+  // Only reached if an interrupt was pending, the core did not enter Standby
+  PWR->CR &= ~PWR_CR_PDDS;
+  PWR->CSR &= ~PWR_CSR_EWUP;
+  rtc.ClearWakeup();
+}
+
+void PowerManagerType::Report() const
+{
+  printf("state          ms permille entries\n");
+
+  for (std::size_t index = 0; index < PowerStateCount; ++index)
+  {
+    const auto state = static_cast<PowerState>(index);
+
+    printf("%-8s %8lu %8lu %7lu\n",
+      PowerStateNames[index],
+      static_cast<unsigned long>(residency.GetMilliseconds(state)),
+      static_cast<unsigned long>(residency.GetPermille(state)),
+      static_cast<unsigned long>(residency.GetEntries(state)));
+  }
+
+  printf("stop wakeup: %lu us last, %lu us max\n",
+    static_cast<unsigned long>(wakeupStatistics.lastLatency),
+    static_cast<unsigned long>(wakeupStatistics.maxLatency));
+  printf("standby: %u entries, %lu s\n",
+    static_cast<unsigned>(retained.standbyEntries),
+    static_cast<unsigned long>(retained.standbySeconds));
+}
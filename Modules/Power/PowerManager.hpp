@@ -0,0 +1,131 @@
+/// @file PowerManager.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Power manager choosing between Sleep, Stop and Standby from the next deadline.
+/// @details Sleep keeps all peripherals running and wakes up on any interrupt. Stop halts the clocks of the core and
+///          the peripherals, the RTC alarm wakes the core at the last full second before the deadline, an edge of
+///          a watched input wakes it earlier. Characters received by the USART meanwhile are lost, the timers stand
+///          still. Standby powers the core down, it restarts from reset and only the backup domain is kept, so the
+///          state needed to resume is retained in backup registers.
+
+#ifndef POWER_POWERMANAGER_HPP
+#define POWER_POWERMANAGER_HPP
+
+#include <PowerModes.hpp>
+#include <Rcc.hpp>
+#include <cstdint>
+
+namespace Power
+{
+  /// @brief Wakeup statistics of the Stop mode.
+  struct WakeupStatistics
+  {
+    /// @brief Time from the wakeup until the clocks run again in microseconds, of the last wakeup.
+    uint32_t lastLatency;
+
+    /// @brief Longest time from the wakeup until the clocks run again in microseconds.
+    uint32_t maxLatency;
+  };
+
+  /// @brief Power manager class.
+  class PowerManager
+  {
+   private:
+    /// @brief Minimum idle ticks for the Stop mode, restarting the crystal and the PLL takes up to about 2 ms.
+    static constexpr uint32_t StopMinimumTicks = 100;
+
+    /// @brief Minimum idle ticks for the Standby mode, the core restarts from reset.
+    static constexpr uint32_t StandbyMinimumTicks = 10'000;
+
+    /// @brief Minimum time in Stop mode in crystal cycles, the alarm can only wake up at the start of a second.
+    static constexpr uint32_t MinimumStopCycles = Peripherals::Rcc::LseFrequency / 100;
+
+    /// @brief Policy choosing the power state.
+    PowerPolicy<StopMinimumTicks, StandbyMinimumTicks> policy {};
+
+    /// @brief Time spent in the power states.
+    PowerResidency<Peripherals::Rcc::ResetAndClockControl::Ticks> residency {};
+
+    /// @brief Timestamp at which the core returned from the last idle period.
+    uint64_t runStart = 0;
+
+    /// @brief Wakeup statistics of the Stop mode.
+    WakeupStatistics wakeupStatistics {};
+
+    /// @brief State retained across Standby.
+    RetainedState retained {};
+
+    /// @brief Singleton instance, constant initialized so the accessor needs no guard.
+    static PowerManager instance;
+
+    /// @brief Private constructor to prevent instantiation.
+    constexpr PowerManager() = default;
+
+    /// @brief Stops the clocks until the RTC alarm before the deadline or an EXTI line wakes the core.
+    /// @param idleTicks Ticks until the deadline.
+    /// @param pending Check skipping the Stop mode if work became pending.
+    /// @param context Context passed to the check.
+    /// @return True if the core was in Stop mode, false if the deadline is too close to the next second or work is
+    ///         pending.
+    bool Stop(uint32_t idleTicks, Peripherals::Rcc::WakeCheck pending, void* context);
+
+    /// @brief Powers the core down until the RTC alarm before the deadline or the WKUP pin restart it.
+    /// @param idleTicks Ticks until the deadline.
+    /// @param pending Check skipping the Standby mode if work became pending.
+    /// @param context Context passed to the check.
+    /// @details Only returns if the core cannot enter Standby.
+    void Standby(uint32_t idleTicks, Peripherals::Rcc::WakeCheck pending, void* context);
+
+   public:
+    /// @brief Returns the singleton instance of the power manager class.
+    /// @return Reference to the singleton instance.
+    static constexpr PowerManager& GetInstance()
+    {
+      return instance;
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    PowerManager(const PowerManager&) = delete;
+    PowerManager& operator=(const PowerManager&) = delete;
+    PowerManager(PowerManager&&) = delete;
+    PowerManager& operator=(PowerManager&&) = delete;
+    ~PowerManager() = default;
+
+    /// @brief Starts the real time clock and resumes the retained state after a wakeup from Standby.
+    /// @details Called once all clock listeners are registered, since the retained clock profile is switched to.
+    void Init();
+
+    /// @brief Sleeps in the deepest allowed power state until the deadline or an interrupt.
+    /// @param deadline Tick at which to wake up at the latest.
+    /// @param pending Check whether work became pending, called with interrupts masked before the core sleeps.
+    /// @param context Context passed to the check.
+    void Idle(uint32_t deadline, Peripherals::Rcc::WakeCheck pending = nullptr, void* context = nullptr);
+
+    /// @brief Inhibits a power state and all deeper ones.
+    /// @param state Shallowest inhibited state.
+    void Inhibit(const PowerState state)
+    {
+      policy.Inhibit(state);
+    }
+
+    /// @brief Releases an inhibit taken with `Inhibit()`.
+    /// @param state Shallowest inhibited state.
+    void Release(const PowerState state)
+    {
+      policy.Release(state);
+    }
+
+    /// @brief Returns the wakeup statistics of the Stop mode.
+    /// @return Wakeup statistics.
+    const WakeupStatistics& GetWakeupStatistics() const
+    {
+      return wakeupStatistics;
+    }
+
+    /// @brief Prints the time spent in the power states and the wakeup latency.
+    void Report() const;
+  };
+}  // namespace Power
+
+#endif  // POWER_POWERMANAGER_HPP
@@ -0,0 +1,221 @@
+/// @file PowerModes.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Selection of the low power state, residency accounting and the state retained across Standby.
+/// @details The deeper a state, the longer the wakeup takes, so each state needs a minimum idle time to pay off. The
+///          application can inhibit a state and all deeper ones, e.g. while a peripheral needs its clock. The classes
+///          in this file do not access the hardware, so they can be tested on the host.
+
+#ifndef POWER_POWERMODES_HPP
+#define POWER_POWERMODES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Power
+{
+  /// @brief Power state of the core.
+  enum class PowerState : uint8_t
+  {
+    /// @brief The core runs.
+    Run = 0,
+
+    /// @brief The core clock is stopped, the peripherals and the SysTick timer keep running.
+    Sleep = 1,
+
+    /// @brief All clocks of the 1.8 V domain are stopped, RAM and registers are kept. Woken up by an EXTI line.
+    Stop = 2,
+
+    /// @brief The 1.8 V domain is off, only the backup domain is kept. Woken up by the RTC alarm or the WKUP pin, the
+    ///        core starts from reset.
+    Standby = 3,
+  };
+
+  /// @brief Number of power states.
+  constexpr std::size_t PowerStateCount = 4;
+
+  /// @brief Names of the power states, used in the reports.
+  constexpr std::array<const char*, PowerStateCount> PowerStateNames = {"run", "sleep", "stop", "standby"};
+
+  /// @brief Chooses the deepest allowed power state for an idle period.
+  /// @tparam StopMinimumTicks Minimum idle ticks for the Stop mode.
+  /// @tparam StandbyMinimumTicks Minimum idle ticks for the Standby mode.
+  template<uint32_t StopMinimumTicks, uint32_t StandbyMinimumTicks>
+  class PowerPolicy
+  {
+   private:
+    static_assert(StopMinimumTicks <= StandbyMinimumTicks, "The deeper state needs the longer idle time");
+
+    /// @brief Number of inhibits per state, a state is inhibited together with all deeper ones.
+    std::array<uint8_t, PowerStateCount> inhibits {};
+
+   public:
+    /// @brief Constructor for the PowerPolicy class.
+    constexpr PowerPolicy() = default;
+
+    /// @brief Inhibits a power state and all deeper ones.
+    /// @param state Shallowest inhibited state.
+    /// @details Nests, every call has to be balanced by `Release()`.
+    constexpr void Inhibit(const PowerState state)
+    {
+      ++inhibits[static_cast<std::size_t>(state)];
+    }
+
+    /// @brief Releases an inhibit taken with `Inhibit()`.
+    /// @param state Shallowest inhibited state.
+    constexpr void Release(const PowerState state)
+    {
+      --inhibits[static_cast<std::size_t>(state)];
+    }
+
+    /// @brief Returns whether a power state is allowed.
+    /// @param state Power state.
+    /// @return True if neither the state nor a shallower one is inhibited.
+    constexpr bool IsAllowed(const PowerState state) const
+    {
+      for (std::size_t index = 0; index <= static_cast<std::size_t>(state); ++index)
+      {
+        if (inhibits[index] != 0)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    /// @brief Selects the power state for an idle period.
+    /// @param idleTicks Ticks until the next deadline.
+    /// @return Deepest allowed state which pays off, `Run` if the core must not sleep.
+    constexpr PowerState Select(const uint32_t idleTicks) const
+    {
+      if (idleTicks >= StandbyMinimumTicks && IsAllowed(PowerState::Standby))
+      {
+        return PowerState::Standby;
+      }
+
+      if (idleTicks >= StopMinimumTicks && IsAllowed(PowerState::Stop))
+      {
+        return PowerState::Stop;
+      }
+
+      return (idleTicks > 0 && IsAllowed(PowerState::Sleep)) ? PowerState::Sleep : PowerState::Run;
+    }
+  };
+
+  /// @brief Time spent in the power states.
+  /// @tparam CyclesPerTick Cycles per millisecond tick.
+  template<uint32_t CyclesPerTick>
+  class PowerResidency
+  {
+   private:
+    /// @brief Cycles spent per state.
+    std::array<uint64_t, PowerStateCount> cycles {};
+
+    /// @brief Number of entries per state.
+    std::array<uint32_t, PowerStateCount> entries {};
+
+   public:
+    /// @brief Constructor for the PowerResidency class.
+    constexpr PowerResidency() = default;
+
+    /// @brief Records a period spent in a state.
+    /// @param state Power state.
+    /// @param duration Cycles spent in the state.
+    constexpr void Record(const PowerState state, const uint64_t duration)
+    {
+      cycles[static_cast<std::size_t>(state)] += duration;
+      ++entries[static_cast<std::size_t>(state)];
+    }
+
+    /// @brief Returns the time spent in a state.
+    /// @param state Power state.
+    /// @return Milliseconds spent in the state.
+    constexpr uint64_t GetMilliseconds(const PowerState state) const
+    {
+      return cycles[static_cast<std::size_t>(state)] / CyclesPerTick;
+    }
+
+    /// @brief Returns the number of entries into a state.
+    /// @param state Power state.
+    /// @return Number of recorded periods.
+    constexpr uint32_t GetEntries(const PowerState state) const
+    {
+      return entries[static_cast<std::size_t>(state)];
+    }
+
+    /// @brief Returns the fraction of the recorded time spent in a state.
+    /// @param state Power state.
+    /// @return Fraction in per mille, 0 if nothing is recorded.
+    constexpr uint32_t GetPermille(const PowerState state) const
+    {
+      uint64_t total = 0;
+
+      for (const auto stateCycles : cycles)
+      {
+        total += stateCycles;
+      }
+
+      return total == 0 ? 0U : static_cast<uint32_t>((cycles[static_cast<std::size_t>(state)] * 1000U) / total);
+    }
+  };
+
+  /// @brief State kept in the backup registers while the core is in Standby.
+  struct RetainedState
+  {
+    /// @brief Clock profile to resume with.
+    uint8_t clockProfile;
+
+    /// @brief Number of times the core entered Standby.
+    uint16_t standbyEntries;
+
+    /// @brief RTC counter in seconds when the core entered Standby the last time.
+    uint32_t standbyStart;
+
+    /// @brief Seconds spent in Standby before the last entry.
+    uint32_t standbySeconds;
+
+    /// @brief Number of 16 bit backup registers needed.
+    static constexpr std::size_t WordCount = 6;
+
+    /// @brief Marker in the upper byte of the first word, telling the registers were written on Standby entry.
+    static constexpr uint16_t Marker = 0xA500;
+
+    /// @brief Packs the state into 16 bit backup register values.
+    /// @return Register values.
+    constexpr std::array<uint16_t, WordCount> Pack() const
+    {
+      return {
+        static_cast<uint16_t>(Marker | clockProfile),
+        standbyEntries,
+        static_cast<uint16_t>(standbyStart >> 16U),
+        static_cast<uint16_t>(standbyStart & 0xFFFFU),
+        static_cast<uint16_t>(standbySeconds >> 16U),
+        static_cast<uint16_t>(standbySeconds & 0xFFFFU),
+      };
+    }
+
+    /// @brief Unpacks the state from backup register values.
+    /// @param words Register values.
+    /// @return State, empty if the registers were not written on Standby entry.
+    static constexpr std::optional<RetainedState> Unpack(const std::array<uint16_t, WordCount>& words)
+    {
+      if ((words[0] & 0xFF00U) != Marker)
+      {
+        return std::nullopt;
+      }
+
+      return RetainedState {
+        .clockProfile = static_cast<uint8_t>(words[0] & 0x00FFU),
+        .standbyEntries = words[1],
+        .standbyStart = (static_cast<uint32_t>(words[2]) << 16U) | words[3],
+        .standbySeconds = (static_cast<uint32_t>(words[4]) << 16U) | words[5],
+      };
+    }
+  };
+}  // namespace Power
+
+#endif  // POWER_POWERMODES_HPP
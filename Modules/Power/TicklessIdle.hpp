@@ -0,0 +1,204 @@
+/// @file TicklessIdle.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Tick suppression arithmetic and idle residency accounting for the tickless idle mode.
+/// @details While idle, the periodic SysTick interrupt is replaced by a single interrupt at the next deadline. The
+///          classes in this file compute the reload value for that interrupt and how many ticks have to be added to
+///          the millisecond counter after waking up, independent of the hardware so they can be tested on the host.
+
+#ifndef POWER_TICKLESSIDLE_HPP
+#define POWER_TICKLESSIDLE_HPP
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Power
+{
+  /// @brief Reload programmed into the SysTick timer for one suppressed sleep.
+  struct SuppressionPlan
+  {
+    /// @brief Number of ticks which are suppressed, including the tick in progress.
+    uint32_t ticks;
+
+    /// @brief Cycles remaining in the tick in progress when the sleep started.
+    uint32_t startValue;
+
+    /// @brief Reload value for the SysTick timer.
+    uint32_t reload;
+  };
+
+  /// @brief Result of a suppressed sleep after waking up.
+  struct SuppressionResult
+  {
+    /// @brief Number of tick boundaries passed while sleeping.
+    uint32_t completedTicks;
+
+    /// @brief Number of ticks which have to be added to the tick counter by software.
+    /// @details If the SysTick timer expired, its interrupt is pending and adds the last tick itself.
+    uint32_t tickCompensation;
+
+    /// @brief Cycles until the next tick boundary, used to restart the periodic tick.
+    uint32_t cyclesToNextTick;
+
+    /// @brief Cycles spent sleeping.
+    uint32_t sleptCycles;
+  };
+
+  /// @brief Computes SysTick reload values to suppress ticks while idle and the compensation afterwards.
+  /// @tparam CyclesPerTick SysTick cycles per tick.
+  /// @tparam MaxReload Maximum reload value of the timer.
+  template<uint32_t CyclesPerTick, uint32_t MaxReload = 0x00FFFFFFU>
+  class TickSuppression
+  {
+   public:
+    static_assert(CyclesPerTick > 0 && CyclesPerTick <= MaxReload, "One tick has to fit into the timer");
+
+    /// @brief Maximum number of ticks which can be suppressed in one sleep.
+    static constexpr uint32_t MaxTicks = MaxReload / CyclesPerTick;
+
+    /// @brief Computes the reload value to wake up after the given number of ticks.
+    /// @param idleTicks Number of ticks until the next deadline, including the tick in progress.
+    /// @param currentValue Current value of the stopped timer, the cycles remaining in the tick in progress.
+    /// @return Reload value and number of suppressed ticks.
+    static constexpr SuppressionPlan Plan(const uint32_t idleTicks, const uint32_t currentValue)
+    {
+      const auto ticks = std::clamp<uint32_t>(idleTicks, 1, MaxTicks);
+      const auto startValue = std::clamp<uint32_t>(currentValue, 1, CyclesPerTick);
+
+      return SuppressionPlan {
+        .ticks = ticks,
+        .startValue = startValue,
+        .reload = startValue + (CyclesPerTick * (ticks - 1)) - 1,
+      };
+    }
+
+    /// @brief Computes the elapsed ticks after waking up.
+    /// @param plan Plan the timer was programmed with.
+    /// @param expired True if the timer reached zero while sleeping.
+    /// @param currentValue Current value of the stopped timer.
+    /// @return Elapsed ticks and the cycles until the next tick boundary.
+    /// @details The timer is started from zero, so it loads the reload value with the first cycle and expires after
+    ///          reload + 1 cycles. After expiring, it reloads and keeps counting down from the reload value.
+    static constexpr SuppressionResult Resume(const SuppressionPlan& plan, const bool expired, const uint32_t currentValue)
+    {
+      const auto counted = (currentValue == 0) ? uint32_t {0} : plan.reload + 1 - std::min(currentValue, plan.reload);
+      const auto sleptCycles = expired ? plan.reload + 1 + counted : counted;
+
+      if (sleptCycles < plan.startValue)
+      {
+        return SuppressionResult {
+          .completedTicks = 0,
+          .tickCompensation = 0,
+          .cyclesToNextTick = plan.startValue - sleptCycles,
+          .sleptCycles = sleptCycles,
+        };
+      }
+
+      const auto afterFirstTick = sleptCycles - plan.startValue;
+      const auto completedTicks = 1 + (afterFirstTick / CyclesPerTick);
+
+      return SuppressionResult {
+        .completedTicks = completedTicks,
+        .tickCompensation = expired ? completedTicks - 1 : completedTicks,
+        .cyclesToNextTick = CyclesPerTick - (afterFirstTick % CyclesPerTick),
+        .sleptCycles = sleptCycles,
+      };
+    }
+  };
+
+  /// @brief Progress of the tick after the tick timer was stopped for a while.
+  struct TickProgress
+  {
+    /// @brief Number of tick boundaries passed while the timer was stopped.
+    uint32_t completedTicks;
+
+    /// @brief Cycles until the next tick boundary, used to restart the periodic tick.
+    uint32_t cyclesToNextTick;
+  };
+
+  /// @brief Computes the ticks passed while the tick timer was stopped, e.g. in Stop mode.
+  /// @param value Value of the timer when it was stopped, the cycles remaining in the tick in progress.
+  /// @param elapsed Cycles elapsed while the timer was stopped, measured by another clock.
+  /// @param cyclesPerTick Timer cycles per tick.
+  /// @return Passed ticks and the cycles until the next tick boundary.
+  constexpr TickProgress AdvanceStoppedTick(const uint32_t value, const uint64_t elapsed, const uint32_t cyclesPerTick)
+  {
+    const auto remaining = std::clamp<uint32_t>(value, 1, cyclesPerTick);
+
+    if (elapsed < remaining)
+    {
+      return TickProgress {
+        .completedTicks = 0,
+        .cyclesToNextTick = remaining - static_cast<uint32_t>(elapsed),
+      };
+    }
+
+    const auto afterFirstTick = elapsed - remaining;
+
+    return TickProgress {
+      .completedTicks = static_cast<uint32_t>(1 + (afterFirstTick / cyclesPerTick)),
+      .cyclesToNextTick = cyclesPerTick - static_cast<uint32_t>(afterFirstTick % cyclesPerTick),
+    };
+  }
+
+  /// @brief Idle residency counters.
+  struct IdleStatistics
+  {
+    /// @brief Number of times the core entered sleep.
+    uint32_t entries;
+
+    /// @brief Total cycles spent sleeping.
+    uint64_t sleptCycles;
+
+    /// @brief Milliseconds spent sleeping during the last completed window.
+    uint32_t lastWindowSleptMilliseconds;
+  };
+
+  /// @brief Accumulates the time spent sleeping per window.
+  /// @tparam CyclesPerTick Cycles per millisecond tick.
+  /// @tparam WindowTicks Length of the window in ticks.
+  template<uint32_t CyclesPerTick, uint32_t WindowTicks = 1000>
+  class IdleResidency
+  {
+   private:
+    /// @brief Tick at which the current window started.
+    uint32_t windowStart = 0;
+
+    /// @brief Cycles spent sleeping in the current window.
+    uint64_t windowCycles = 0;
+
+    /// @brief Accumulated counters.
+    IdleStatistics statistics {};
+
+   public:
+    /// @brief Records a sleep period.
+    /// @param now Tick after waking up.
+    /// @param sleptCycles Cycles spent sleeping.
+    /// @details A sleep crossing a window boundary is accounted to the window in which it started.
+    constexpr void Record(const uint32_t now, const uint32_t sleptCycles)
+    {
+      ++statistics.entries;
+      statistics.sleptCycles += sleptCycles;
+      windowCycles += sleptCycles;
+
+      const auto elapsed = now - windowStart;
+
+      if (elapsed >= WindowTicks)
+      {
+        statistics.lastWindowSleptMilliseconds = static_cast<uint32_t>(windowCycles / CyclesPerTick);
+        windowStart = now - (elapsed % WindowTicks);
+        windowCycles = 0;
+      }
+    }
+
+    /// @brief Returns the accumulated counters.
+    /// @return Idle residency counters.
+    constexpr const IdleStatistics& GetStatistics() const
+    {
+      return statistics;
+    }
+  };
+}  // namespace Power
+
+#endif  // POWER_TICKLESSIDLE_HPP
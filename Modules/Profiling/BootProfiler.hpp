@@ -0,0 +1,130 @@
+/// @file BootProfiler.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Timestamps of the boot milestones based on the DWT cycle counter.
+/// @details The reset handler restarts the cycle counter before the RAM is initialized, the milestones count from
+///          there. The core runs from the internal oscillator until the clocks are configured, so every interval is
+///          converted with the core clock at its start. The interval in which the clock is switched is therefore
+///          converted with the slow clock, which only overestimates the few cycles after the switch.
+
+#ifndef PROFILING_BOOTPROFILER_HPP
+#define PROFILING_BOOTPROFILER_HPP
+
+#include <Dwt.hpp>
+#include <Rcc.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace Profiling
+{
+  /// @brief Milestones of the boot.
+  enum class BootMilestone : uint8_t
+  {
+    /// @brief `main` entered, .data and .bss are initialized and the static constructors ran.
+    MainEntered = 0,
+
+    /// @brief The LEDs are switched on, the first output visible outside.
+    FirstOutput = 1,
+
+    /// @brief The system clock runs from the PLL and the SysTick timer is started.
+    ClocksReady = 2,
+
+    /// @brief All tasks are constructed.
+    TasksReady = 3,
+
+    /// @brief The background thread dispatches the periodic tasks for the first time.
+    FirstDispatch = 4,
+  };
+
+  /// @brief Number of boot milestones.
+  constexpr std::size_t BootMilestoneCount = 5;
+
+  /// @brief Names of the boot milestones, used in the report.
+  constexpr std::array<const char*, BootMilestoneCount> BootMilestoneNames = {
+    "main", "output", "clocks", "tasks", "dispatch"};
+
+  /// @brief Records the time of the boot milestones since reset.
+  class BootProfiler
+  {
+   private:
+    /// @brief Nanoseconds since reset at the milestones, 0 if a milestone is not reached yet.
+    std::array<uint64_t, BootMilestoneCount> nanoseconds {};
+
+    /// @brief Cycle counter value at the previous milestone.
+    uint32_t previousCycles = 0;
+
+    /// @brief Core clock in Hz at the previous milestone, the reset handler runs from the internal oscillator.
+    uint32_t previousClock = Peripherals::Rcc::HsiFrequency;
+
+    /// @brief Nanoseconds since reset at the previous milestone.
+    uint64_t previousNanoseconds = 0;
+
+   public:
+    /// @brief Constructor for the BootProfiler class.
+    constexpr BootProfiler() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    BootProfiler(const BootProfiler&) = delete;
+    BootProfiler& operator=(const BootProfiler&) = delete;
+    BootProfiler(BootProfiler&&) = delete;
+    BootProfiler& operator=(BootProfiler&&) = delete;
+    ~BootProfiler() = default;
+
+    /// @brief Records a milestone.
+    /// @param milestone Milestone reached.
+    /// @param cycles Cycle counter value, counted from the reset handler on.
+    /// @param coreClock Core clock in Hz from now on.
+    /// @details The milestones have to be recorded in the order they are reached, repeated ones are ignored.
+    constexpr void Record(const BootMilestone milestone, const uint32_t cycles, const uint32_t coreClock)
+    {
+      auto& entry = nanoseconds[static_cast<std::size_t>(milestone)];
+
+      if (entry != 0)
+      {
+        return;
+      }
+
+      previousNanoseconds += (static_cast<uint64_t>(cycles - previousCycles) * 1'000'000'000U) / previousClock;
+      previousCycles = cycles;
+      previousClock = coreClock;
+      entry = previousNanoseconds;
+    }
+
+    /// @brief Records a milestone with the current cycle counter value and core clock.
+    /// @param milestone Milestone reached.
+    void Record(const BootMilestone milestone)
+    {
+      const auto cycles = Peripherals::Dwt::CycleCounter::Now();
+      Record(milestone, cycles, Peripherals::Rcc::ResetAndClockControl::GetInstance().GetClocks().systemClock);
+    }
+
+    /// @brief Returns the time of a milestone since reset.
+    /// @param milestone Milestone to get the time for.
+    /// @return Microseconds since reset, 0 if the milestone is not reached yet.
+    constexpr uint32_t GetMicroseconds(const BootMilestone milestone) const
+    {
+      return static_cast<uint32_t>(nanoseconds[static_cast<std::size_t>(milestone)] / 1000U);
+    }
+
+    /// @brief Prints the time of the milestones since reset.
+    void Report() const
+    {
+      printf("milestone       us\n");
+
+      for (std::size_t i = 0; i < BootMilestoneCount; ++i)
+      {
+        printf("%-9s %8lu\n",
+          BootMilestoneNames[i],
+          static_cast<unsigned long>(GetMicroseconds(static_cast<BootMilestone>(i))));
+      }
+    }
+  };
+
+  /// @brief Profiler of the boot.
+  inline constinit BootProfiler bootProfiler {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace Profiling
+
+#endif  // PROFILING_BOOTPROFILER_HPP
@@ -0,0 +1,229 @@
+/// @file TaskProfiler.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Per task CPU accounting based on the DWT cycle counter.
+/// @details The instrumentation is only compiled in if `TASK_PROFILING` is defined. Otherwise `Begin` and `End` are
+///          empty and the profiler is never referenced, so neither code nor RAM is spent on it.
+
+#ifndef PROFILING_TASKPROFILER_HPP
+#define PROFILING_TASKPROFILER_HPP
+
+#include <Dwt.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+namespace Profiling
+{
+#if defined(TASK_PROFILING)
+  /// @brief Whether the tasks are instrumented.
+  constexpr bool Enabled = true;
+#else
+  /// @brief Whether the tasks are instrumented.
+  constexpr bool Enabled = false;
+#endif
+
+  /// @brief Instrumented tasks.
+  enum class TaskId : uint8_t
+  {
+    /// @brief Print task, reacting to the interrupt events.
+    Print = 0,
+
+    /// @brief LEDs task.
+    Leds = 1,
+
+    /// @brief Display task.
+    Display = 2,
+  };
+
+  /// @brief Number of instrumented tasks.
+  constexpr std::size_t TaskCount = 3;
+
+  /// @brief Names of the instrumented tasks, used by the report.
+  constexpr std::array<const char*, TaskCount> TaskNames = {"print", "leds", "display"};
+
+  /// @brief Execution time statistics of a task.
+  struct CycleStatistics
+  {
+    /// @brief Number of recorded runs.
+    uint32_t runs = 0;
+
+    /// @brief Shortest run in cycles.
+    uint32_t minimum = std::numeric_limits<uint32_t>::max();
+
+    /// @brief Longest run in cycles.
+    uint32_t maximum = 0;
+
+    /// @brief Sum of all runs in cycles.
+    uint64_t total = 0;
+
+    /// @brief Number of runs which exceeded the budget.
+    uint32_t overruns = 0;
+
+    /// @brief Records a run.
+    /// @param cycles Duration of the run in cycles.
+    /// @param budget Maximum duration in cycles, longer runs are counted as overrun.
+    constexpr void Record(const uint32_t cycles, const uint32_t budget)
+    {
+      ++runs;
+      total += cycles;
+      minimum = cycles < minimum ? cycles : minimum;
+      maximum = cycles > maximum ? cycles : maximum;
+
+      if (cycles > budget)
+      {
+        ++overruns;
+      }
+    }
+
+    /// @brief Returns the mean duration of a run.
+    /// @return Mean duration in cycles, 0 if nothing is recorded.
+    constexpr uint32_t GetMean() const
+    {
+      return runs == 0 ? 0 : static_cast<uint32_t>(total / runs);
+    }
+  };
+
+  /// @brief Execution time statistics of all instrumented tasks.
+  class TaskProfiler
+  {
+   private:
+    /// @brief Statistics per task.
+    std::array<CycleStatistics, TaskCount> statistics {};
+
+   public:
+    /// @brief Constructor for the TaskProfiler class.
+    constexpr TaskProfiler() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    TaskProfiler(const TaskProfiler&) = delete;
+    TaskProfiler& operator=(const TaskProfiler&) = delete;
+    TaskProfiler(TaskProfiler&&) = delete;
+    TaskProfiler& operator=(TaskProfiler&&) = delete;
+    ~TaskProfiler() = default;
+
+    /// @brief Records a run of a task.
+    /// @param task Task which ran.
+    /// @param cycles Duration of the run in cycles.
+    /// @param budget Maximum duration in cycles.
+    constexpr void Record(const TaskId task, const uint32_t cycles, const uint32_t budget)
+    {
+      statistics[static_cast<std::size_t>(task)].Record(cycles, budget);
+    }
+
+    /// @brief Returns the statistics of a task.
+    /// @param task Task to get the statistics for.
+    /// @return Statistics of the task.
+    constexpr const CycleStatistics& GetStatistics(const TaskId task) const
+    {
+      return statistics[static_cast<std::size_t>(task)];
+    }
+
+    /// @brief Prints the statistics of all tasks to the standard output.
+    void Report() const
+    {
+      printf("task     runs       min       max      mean overruns\n");
+
+      for (std::size_t i = 0; i < TaskCount; ++i)
+      {
+        const auto& entry = statistics[i];
+
+        printf("%-8s %4lu %9lu %9lu %9lu %8lu\n",
+          TaskNames[i],
+          static_cast<unsigned long>(entry.runs),
+          static_cast<unsigned long>(entry.runs == 0 ? 0 : entry.minimum),
+          static_cast<unsigned long>(entry.maximum),
+          static_cast<unsigned long>(entry.GetMean()),
+          static_cast<unsigned long>(entry.overruns));
+      }
+    }
+  };
+
+  /// @brief Profiler of the application tasks.
+  inline constinit TaskProfiler taskProfiler {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Starts the cycle counter, if the instrumentation is enabled.
+  inline void Initialize()
+  {
+    if constexpr (Enabled)
+    {
+      Peripherals::Dwt::CycleCounter::Enable();
+    }
+  }
+
+  /// @brief Marks the start of a measured section.
+  /// @return Cycle counter value at the start.
+  inline uint32_t Begin()
+  {
+    if constexpr (Enabled)
+    {
+      return Peripherals::Dwt::CycleCounter::Now();
+    }
+
+    return 0;
+  }
+
+  /// @brief Marks the end of a measured section and records its duration.
+  /// @tparam Task Task which ran.
+  /// @tparam Budget Maximum duration in cycles.
+  /// @param start Value returned by `Begin`.
+  /// @details The duration includes interrupt handlers and threads with a higher priority preempting the task.
+  template<TaskId Task, uint32_t Budget>
+  inline void End(const uint32_t start)
+  {
+    if constexpr (Enabled)
+    {
+      taskProfiler.Record(Task, Peripherals::Dwt::CycleCounter::Now() - start, Budget);
+    }
+  }
+
+  /// @brief Instrumented task for the static scheduler.
+  /// @tparam Id Task which is measured.
+  /// @tparam Task Type of the task.
+  /// @tparam CyclesPerMicrosecond Core clock cycles per microsecond, used to convert the budget of the task.
+  /// @details Forwards the schedule of the task, so the adapter takes its place in the task table. If the
+  ///          instrumentation is disabled, `Run` only calls the task.
+  template<TaskId Id, class Task, uint32_t CyclesPerMicrosecond>
+  class Profiled
+  {
+   private:
+    /// @brief Task which is measured.
+    Task& task;
+
+   public:
+    /// @brief Period of the task in ticks.
+    static constexpr uint32_t Period = Task::Period;
+
+    /// @brief Release offset of the task in ticks.
+    static constexpr uint32_t Phase = Task::Phase;
+
+    /// @brief Worst case execution time of a release in microseconds.
+    static constexpr uint32_t Budget = Task::Budget;
+
+    /// @brief Constructor for the Profiled class.
+    /// @param task Task which is measured.
+    explicit constexpr Profiled(Task& task) : task(task)
+    {
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    Profiled(const Profiled&) = delete;
+    Profiled& operator=(const Profiled&) = delete;
+    Profiled(Profiled&&) = delete;
+    Profiled& operator=(Profiled&&) = delete;
+    ~Profiled() = default;
+
+    /// @brief Runs the task and records its duration.
+    void Run()
+    {
+      const auto start = Begin();
+      task.Run();
+      End<Id, Budget * CyclesPerMicrosecond>(start);
+    }
+  };
+}  // namespace Profiling
+
+#endif  // PROFILING_TASKPROFILER_HPP
@@ -0,0 +1,545 @@
+/// @file Coroutine.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Stackless coroutine tasks.
+/// @details A coroutine task can wait for a time span or an event with `co_await` instead of blocking the whole
+///          system. Waiting suspends the coroutine and returns to the executor, which resumes it once the deadline is
+///          reached or the event is set. Coroutines can await other coroutines, the frames are allocated from a static
+///          arena.
+
+#ifndef SCHEDULER_COROUTINE_HPP
+#define SCHEDULER_COROUTINE_HPP
+
+#include <FrameArena.hpp>
+#include <Scheduler.hpp>
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+namespace Scheduler
+{
+  /// @brief Size of a coroutine frame block in bytes.
+  constexpr std::size_t FrameBlockSize = 160;
+
+  /// @brief Number of coroutine frame blocks, one per coroutine in flight including the awaited ones.
+  constexpr std::size_t FrameBlockCount = 8;
+
+  /// @brief Arena type for the coroutine frames.
+  using FrameArenaType = FrameArena<FrameBlockSize, FrameBlockCount>;
+
+  /// @brief Arena for all coroutine frames.
+  inline constinit FrameArenaType frameArena {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Event a coroutine can wait for.
+  /// @details Setting the event is safe from interrupt handlers. The event stays set until one waiting coroutine
+  ///          consumed it.
+  class Event
+  {
+   private:
+    /// @brief Flag whether the event is set.
+    std::atomic<bool> set {false};
+
+   public:
+    /// @brief Constructor for the Event class.
+    constexpr Event() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    Event(const Event&) = delete;
+    Event& operator=(const Event&) = delete;
+    Event(Event&&) = delete;
+    Event& operator=(Event&&) = delete;
+    ~Event() = default;
+
+    /// @brief Sets the event.
+    void Set()
+    {
+      set.store(true, std::memory_order_release);
+    }
+
+    /// @brief Returns whether the event is set, without consuming it.
+    /// @return True if the event is set.
+    bool IsSet() const
+    {
+      return set.load(std::memory_order_acquire);
+    }
+
+    /// @brief Consumes the event if it is set.
+    /// @return True if the event was set.
+    bool TryConsume()
+    {
+      return set.exchange(false, std::memory_order_acquire);
+    }
+  };
+
+  /// @brief Reason a coroutine task is suspended.
+  enum class WaitKind : uint8_t
+  {
+    /// @brief The task can be resumed immediately.
+    Ready,
+
+    /// @brief The task waits for a number of ticks relative to its suspension.
+    Duration,
+
+    /// @brief The task waits for an absolute tick.
+    Deadline,
+
+    /// @brief The task waits for an event.
+    Event,
+  };
+
+  /// @brief Coroutine task, which can be run by the executor or awaited by another task.
+  class Task
+  {
+   public:
+    /// @brief Promise type of the coroutine task.
+    struct promise_type  // NOLINT(readability-identifier-naming)
+    {
+      /// @brief Coroutine awaiting this one, resumed when this one completes.
+      std::coroutine_handle<> continuation;
+
+      /// @brief Promise of the outermost coroutine, which is run by the executor.
+      promise_type* root = this;
+
+      /// @brief Innermost suspended coroutine, only valid in the root promise.
+      /// @details Initialized to the own coroutine, so the executor starts a root task at its beginning.
+      std::coroutine_handle<> leaf;
+
+      /// @brief Reason of the suspension, only valid in the root promise.
+      WaitKind wait = WaitKind::Ready;
+
+      /// @brief Ticks or deadline to wait for, only valid in the root promise.
+      uint32_t ticks = 0;
+
+      /// @brief Event to wait for, only valid in the root promise.
+      Event* event = nullptr;
+
+      /// @brief Allocates the coroutine frame from the arena.
+      /// @param size Size of the frame.
+      /// @return Pointer to the frame or nullptr if the arena is exhausted.
+      static void* operator new(const std::size_t size) noexcept
+      {
+        return frameArena.Allocate(size);
+      }
+
+      /// @brief Returns the coroutine frame to the arena.
+      /// @param frame Pointer to the frame.
+      static void operator delete(void* frame) noexcept
+      {
+        frameArena.Deallocate(frame);
+      }
+
+      /// @brief Returns an empty task if the frame could not be allocated.
+      /// @return Empty task.
+      /// @details The arena counts the failure. `CoroutineExecutor::Spawn()` rejects an empty task and awaiting one
+      ///          completes at once, so the caller has to check the result or the failure is only seen in the count.
+      static Task get_return_object_on_allocation_failure()  // NOLINT(readability-identifier-naming)
+      {
+        return Task {};
+      }
+
+      Task get_return_object()  // NOLINT(readability-identifier-naming)
+      {
+        const auto handle = std::coroutine_handle<promise_type>::from_promise(*this);
+        leaf = handle;
+
+        return Task {handle};
+      }
+
+      std::suspend_always initial_suspend() noexcept  // NOLINT(readability-identifier-naming)
+      {
+        return {};
+      }
+
+      /// @brief Awaiter transferring control to the awaiting coroutine when the task completes.
+      struct FinalAwaiter
+      {
+        bool await_ready() noexcept  // NOLINT(readability-identifier-naming)
+        {
+          return false;
+        }
+
+        std::coroutine_handle<> await_suspend(  // NOLINT(readability-identifier-naming)
+          std::coroutine_handle<promise_type> handle) noexcept
+        {
+          auto& promise = handle.promise();
+
+          if (promise.continuation)
+          {
+            promise.root->leaf = promise.continuation;
+            return promise.continuation;
+          }
+
+          return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept  // NOLINT(readability-identifier-naming)
+        {
+        }
+      };
+
+      FinalAwaiter final_suspend() noexcept  // NOLINT(readability-identifier-naming)
+      {
+        return {};
+      }
+
+      void return_void()  // NOLINT(readability-identifier-naming)
+      {
+      }
+
+      void unhandled_exception()  // NOLINT(readability-identifier-naming)
+      {
+        std::abort();
+      }
+    };
+
+    using HandleType = std::coroutine_handle<promise_type>;
+
+   private:
+    /// @brief Handle of the owned coroutine.
+    HandleType handle;
+
+    /// @brief Constructor for the Task class.
+    /// @param handle Handle of the coroutine to own.
+    explicit Task(const HandleType handle) : handle {handle}
+    {
+    }
+
+   public:
+    /// @brief Constructor for an empty task.
+    Task() = default;
+
+    // Deleted copy constructor and assignment operator.
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /// @brief Move constructor for the Task class.
+    /// @param other Task to take the coroutine from.
+    Task(Task&& other) noexcept : handle {std::exchange(other.handle, {})}
+    {
+    }
+
+    /// @brief Move assignment operator for the Task class.
+    /// @param other Task to take the coroutine from.
+    /// @return Reference to this task.
+    Task& operator=(Task&& other) noexcept
+    {
+      if (this != &other)
+      {
+        Reset();
+        handle = std::exchange(other.handle, {});
+      }
+
+      return *this;
+    }
+
+    /// @brief Destructor for the Task class, destroys the owned coroutine.
+    ~Task()
+    {
+      Reset();
+    }
+
+    /// @brief Destroys the owned coroutine.
+    void Reset()
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle = {};
+      }
+    }
+
+    /// @brief Returns whether the task has no coroutine or the coroutine has completed.
+    /// @return True if the task is done.
+    bool Done() const
+    {
+      return !handle || handle.done();
+    }
+
+    /// @brief Returns the promise of the owned coroutine.
+    /// @return Promise of the coroutine.
+    promise_type& GetPromise() const
+    {
+      return handle.promise();
+    }
+
+    bool await_ready() const  // NOLINT(readability-identifier-naming)
+    {
+      return Done();
+    }
+
+    /// @brief Starts the awaited task and resumes the awaiting one when it completes.
+    /// @param awaiting Handle of the awaiting coroutine.
+    /// @return Handle of the awaited coroutine to run next.
+    std::coroutine_handle<> await_suspend(HandleType awaiting)  // NOLINT(readability-identifier-naming)
+    {
+      auto& promise = handle.promise();
+      promise.continuation = awaiting;
+      promise.root = awaiting.promise().root;
+      promise.root->leaf = handle;
+
+      return handle;
+    }
+
+    void await_resume()  // NOLINT(readability-identifier-naming)
+    {
+    }
+  };
+
+  /// @brief Awaiter suspending a task until a time or an event.
+  class WaitAwaiter
+  {
+   private:
+    /// @brief Reason of the suspension.
+    WaitKind wait;
+
+    /// @brief Ticks or deadline to wait for.
+    uint32_t ticks;
+
+    /// @brief Event to wait for.
+    Event* event;
+
+   public:
+    /// @brief Constructor for the WaitAwaiter class.
+    /// @param wait Reason of the suspension.
+    /// @param ticks Ticks or deadline to wait for.
+    /// @param event Event to wait for.
+    constexpr WaitAwaiter(const WaitKind wait, const uint32_t ticks, Event* event)
+      : wait {wait}, ticks {ticks}, event {event}
+    {
+    }
+
+    bool await_ready()  // NOLINT(readability-identifier-naming)
+    {
+      return (wait == WaitKind::Event) && event->TryConsume();
+    }
+
+    void await_suspend(Task::HandleType handle)  // NOLINT(readability-identifier-naming)
+    {
+      auto* root = handle.promise().root;
+      root->leaf = handle;
+      root->wait = wait;
+      root->ticks = ticks;
+      root->event = event;
+    }
+
+    void await_resume()  // NOLINT(readability-identifier-naming)
+    {
+    }
+  };
+
+  /// @brief Suspends the awaiting task for a number of ticks.
+  /// @param ticks Number of ticks to wait.
+  /// @return Awaiter for `co_await`.
+  constexpr WaitAwaiter SleepFor(const uint32_t ticks)
+  {
+    return WaitAwaiter(WaitKind::Duration, ticks, nullptr);
+  }
+
+  /// @brief Suspends the awaiting task until a tick is reached.
+  /// @param deadline Tick to wait for.
+  /// @return Awaiter for `co_await`.
+  constexpr WaitAwaiter SleepUntil(const uint32_t deadline)
+  {
+    return WaitAwaiter(WaitKind::Deadline, deadline, nullptr);
+  }
+
+  /// @brief Suspends the awaiting task until an event is set.
+  /// @param event Event to wait for.
+  /// @return Awaiter for `co_await`.
+  /// @note `co_await event` is equivalent.
+  constexpr WaitAwaiter Wait(Event& event)
+  {
+    return WaitAwaiter(WaitKind::Event, 0, &event);
+  }
+
+  /// @brief Allows waiting for an event with `co_await event`.
+  /// @param event Event to wait for.
+  /// @return Awaiter for `co_await`.
+  constexpr WaitAwaiter operator co_await(Event& event)
+  {
+    return Wait(event);
+  }
+
+  /// @brief Executor resuming coroutine tasks when their deadline is reached or their event is set.
+  /// @tparam TickSource Type providing the current tick by a static `Now()` method.
+  /// @tparam MaxTasks Maximum number of tasks run at the same time.
+  template<class TickSource, std::size_t MaxTasks>
+  class CoroutineExecutor
+  {
+   private:
+    /// @brief Tasks run by the executor.
+    std::array<Task, MaxTasks> tasks {};
+
+    /// @brief Returns whether the suspended task can be resumed.
+    /// @param promise Root promise of the task.
+    /// @param now Current tick.
+    /// @return True if the task can be resumed.
+    static bool IsReady(Task::promise_type& promise, const uint32_t now)
+    {
+      switch (promise.wait)
+      {
+        case WaitKind::Deadline:
+          return IsDue(now, promise.ticks);
+        case WaitKind::Event:
+          return promise.event->TryConsume();
+        default:
+          return true;
+      }
+    }
+
+   public:
+    /// @brief Constructor for the CoroutineExecutor class.
+    CoroutineExecutor() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    CoroutineExecutor(const CoroutineExecutor&) = delete;
+    CoroutineExecutor& operator=(const CoroutineExecutor&) = delete;
+    CoroutineExecutor(CoroutineExecutor&&) = delete;
+    CoroutineExecutor& operator=(CoroutineExecutor&&) = delete;
+    ~CoroutineExecutor() = default;
+
+    /// @brief Adds a task, it is started by the next call to `Poll`.
+    /// @param task Task to run.
+    /// @return True if the task was added, false if it is empty or all slots are used.
+    bool Spawn(Task&& task)
+    {
+      if (task.Done())
+      {
+        return false;
+      }
+
+      for (auto& slot : tasks)
+      {
+        if (slot.Done())
+        {
+          slot = std::move(task);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    /// @brief Resumes all tasks whose deadline is reached or whose event is set.
+    /// @return Number of resumed tasks.
+    /// @details A task runs until it awaits the next time or event. Completed tasks are destroyed.
+    std::size_t Poll()
+    {
+      std::size_t resumed = 0;
+
+      for (auto& task : tasks)
+      {
+        if (task.Done())
+        {
+          task.Reset();
+          continue;
+        }
+
+        auto& promise = task.GetPromise();
+        const auto now = TickSource::Now();
+
+        if (!IsReady(promise, now))
+        {
+          continue;
+        }
+
+        promise.wait = WaitKind::Ready;
+        promise.leaf.resume();
+        ++resumed;
+
+        if (task.Done())
+        {
+          task.Reset();
+        }
+        else if (promise.wait == WaitKind::Duration)
+        {
+          // Durations are relative to the suspension
+          promise.wait = WaitKind::Deadline;
+          promise.ticks += TickSource::Now();
+        }
+      }
+
+      return resumed;
+    }
+
+    /// @brief Returns the earliest deadline of all sleeping tasks.
+    /// @param fallback Tick returned if no task is sleeping.
+    /// @return Earliest deadline, the current tick if a task is ready or the fallback.
+    uint32_t GetNextWakeup(const uint32_t fallback) const
+    {
+      const auto now = TickSource::Now();
+      auto next = fallback;
+
+      for (const auto& task : tasks)
+      {
+        if (task.Done())
+        {
+          continue;
+        }
+
+        const auto& promise = task.GetPromise();
+
+        if (promise.wait == WaitKind::Ready)
+        {
+          return now;
+        }
+
+        if ((promise.wait == WaitKind::Deadline) &&
+            (static_cast<int32_t>(promise.ticks - now) < static_cast<int32_t>(next - now)))
+        {
+          next = promise.ticks;
+        }
+      }
+
+      return next;
+    }
+
+    /// @brief Returns whether a task can be resumed right away, because it is ready or its event is set.
+    /// @return True if the next `Poll` resumes a task regardless of the time.
+    /// @details Consumes no event, so it may be checked with interrupts masked right before sleeping. An event set
+    ///          after the last `Poll` is otherwise only seen at the next deadline.
+    bool HasReadyTask() const
+    {
+      for (const auto& task : tasks)
+      {
+        if (task.Done())
+        {
+          continue;
+        }
+
+        const auto& promise = task.GetPromise();
+
+        if ((promise.wait == WaitKind::Ready) || ((promise.wait == WaitKind::Event) && promise.event->IsSet()))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    /// @brief Returns the number of tasks which are not completed.
+    /// @return Number of active tasks.
+    std::size_t GetActiveTasks() const
+    {
+      std::size_t count = 0;
+
+      for (const auto& task : tasks)
+      {
+        if (!task.Done())
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+  };
+}  // namespace Scheduler
+
+#endif  // SCHEDULER_COROUTINE_HPP
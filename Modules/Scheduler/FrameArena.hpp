@@ -0,0 +1,117 @@
+/// @file FrameArena.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Static block pool for coroutine frames.
+/// @details The heap is only 0x200 bytes and exceptions are disabled, so coroutine frames are taken from a pool of
+///          fixed size blocks whose size and count are known at compile time.
+
+#ifndef SCHEDULER_FRAMEARENA_HPP
+#define SCHEDULER_FRAMEARENA_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Scheduler
+{
+  /// @brief Pool of fixed size blocks for coroutine frames.
+  /// @tparam BlockSize Size of a block in bytes.
+  /// @tparam BlockCount Number of blocks, at most 32.
+  template<std::size_t BlockSize, std::size_t BlockCount>
+  class FrameArena
+  {
+   private:
+    static_assert(BlockCount > 0 && BlockCount <= 32, "The block usage is tracked in a single word");
+    static_assert(BlockSize % alignof(std::max_align_t) == 0, "Blocks have to keep the maximum alignment");
+
+    /// @brief Storage of the blocks.
+    alignas(std::max_align_t) std::array<std::byte, BlockSize * BlockCount> storage {};
+
+    /// @brief Bit mask of the used blocks.
+    uint32_t used = 0;
+
+    /// @brief Maximum number of blocks used at the same time.
+    std::size_t highWater = 0;
+
+    /// @brief Number of allocations which could not be served.
+    uint32_t failures = 0;
+
+   public:
+    /// @brief Constructor for the FrameArena class.
+    constexpr FrameArena() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+    ~FrameArena() = default;
+
+    /// @brief Allocates a block.
+    /// @param size Requested size in bytes.
+    /// @return Pointer to the block or nullptr if the size is too large or all blocks are used.
+    void* Allocate(const std::size_t size)
+    {
+      if (size > BlockSize)
+      {
+        ++failures;
+        return nullptr;
+      }
+
+      for (std::size_t i = 0; i < BlockCount; ++i)
+      {
+        const auto mask = uint32_t {1} << i;
+
+        if ((used & mask) == 0)
+        {
+          used |= mask;
+          highWater = std::max(highWater, GetUsedBlocks());
+          return &storage[i * BlockSize];
+        }
+      }
+
+      ++failures;
+      return nullptr;
+    }
+
+    /// @brief Returns a block to the pool.
+    /// @param block Pointer returned by `Allocate`.
+    void Deallocate(void* block)
+    {
+      const auto offset = static_cast<std::size_t>(static_cast<std::byte*>(block) - storage.data());
+      used &= ~(uint32_t {1} << (offset / BlockSize));
+    }
+
+    /// @brief Returns the number of blocks in use.
+    /// @return Number of used blocks.
+    std::size_t GetUsedBlocks() const
+    {
+      std::size_t count = 0;
+
+      for (auto remaining = used; remaining != 0; remaining &= remaining - 1)
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    /// @brief Returns the maximum number of blocks used at the same time.
+    /// @return Maximum number of used blocks.
+    std::size_t GetHighWater() const
+    {
+      return highWater;
+    }
+
+    /// @brief Returns the number of allocations which could not be served.
+    /// @return Number of failed allocations.
+    uint32_t GetFailures() const
+    {
+      return failures;
+    }
+  };
+}  // namespace Scheduler
+
+#endif  // SCHEDULER_FRAMEARENA_HPP
@@ -0,0 +1,177 @@
+/// @file Scheduler.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Tick driven cooperative scheduler.
+/// @details The scheduler dispatches every task whose release time is reached according to a tick source. Each task
+///          declares its own period and phase in ticks, so fast polling tasks no longer have to wait for slow ones.
+
+#ifndef SCHEDULER_SCHEDULER_HPP
+#define SCHEDULER_SCHEDULER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Scheduler
+{
+  /// @brief Descriptor of a task which is dispatched by the cooperative scheduler.
+  struct TaskEntry
+  {
+    /// @brief Function which runs the task once.
+    void (*run)(void* context);
+
+    /// @brief Context passed to the run function, usually the task object.
+    void* context;
+
+    /// @brief Period of the task in ticks.
+    uint32_t period;
+
+    /// @brief Offset of the first release relative to the scheduler start in ticks.
+    uint32_t phase;
+  };
+
+  /// @brief Dispatch statistics of a single task.
+  struct TaskStatistics
+  {
+    /// @brief Number of times the task has been dispatched.
+    uint32_t runs;
+
+    /// @brief Maximum observed delay between the release time and the dispatch in ticks.
+    uint32_t maxJitter;
+
+    /// @brief Number of releases which were skipped because the task was dispatched too late.
+    uint32_t missedReleases;
+  };
+
+  /// @brief Creates a task entry for a task object with a `Run()` method and constexpr `Period` and `Phase` members.
+  /// @tparam Task Type of the task.
+  /// @param task Task object to dispatch.
+  /// @return Task entry describing the task.
+  template<class Task>
+  constexpr TaskEntry MakeTask(Task& task)
+  {
+    return TaskEntry {
+      .run = [](void* context) { static_cast<Task*>(context)->Run(); },
+      .context = &task,
+      .period = Task::Period,
+      .phase = Task::Phase,
+    };
+  }
+
+  /// @brief Returns whether the given tick has reached the deadline, taking the wrap around of the counter into account.
+  /// @param now Current tick.
+  /// @param deadline Deadline tick.
+  /// @return True if the deadline is reached.
+  constexpr bool IsDue(const uint32_t now, const uint32_t deadline)
+  {
+    return static_cast<int32_t>(now - deadline) >= 0;
+  }
+
+  /// @brief Cooperative scheduler, dispatching tasks based on their period and phase.
+  /// @tparam TickSource Type providing the current tick by a static `Now()` method.
+  /// @tparam TaskCount Number of tasks managed by the scheduler.
+  /// @details Tasks are checked in table order, so a task listed earlier takes precedence if several are due at the
+  ///          same tick. Every task is run to completion before the next one is checked.
+  template<class TickSource, std::size_t TaskCount>
+  class CooperativeScheduler
+  {
+   private:
+    static_assert(TaskCount > 0, "The scheduler needs at least one task");
+
+    /// @brief Task descriptors in dispatch order.
+    std::array<TaskEntry, TaskCount> tasks;
+
+    /// @brief Next release tick of each task.
+    std::array<uint32_t, TaskCount> releases {};
+
+    /// @brief Dispatch statistics of each task.
+    std::array<TaskStatistics, TaskCount> statistics {};
+
+   public:
+    /// @brief Constructor for the CooperativeScheduler class.
+    /// @param tasks Task descriptors in dispatch order.
+    /// @details The phase of each task is relative to the tick at construction time.
+    explicit CooperativeScheduler(const std::array<TaskEntry, TaskCount>& tasks) : tasks {tasks}
+    {
+      const auto start = TickSource::Now();
+
+      for (std::size_t i = 0; i < TaskCount; ++i)
+      {
+        releases[i] = start + tasks[i].phase;
+      }
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    CooperativeScheduler(const CooperativeScheduler&) = delete;
+    CooperativeScheduler& operator=(const CooperativeScheduler&) = delete;
+    CooperativeScheduler(CooperativeScheduler&&) = delete;
+    CooperativeScheduler& operator=(CooperativeScheduler&&) = delete;
+    ~CooperativeScheduler() = default;
+
+    /// @brief Dispatches all tasks which are due.
+    /// @return Number of dispatched tasks.
+    /// @details The tick is sampled again before each task, so time spent in earlier tasks is accounted for. If a task
+    ///          is dispatched more than one period late, the missed releases are skipped instead of run back to back.
+    std::size_t Dispatch()
+    {
+      std::size_t dispatched = 0;
+
+      for (std::size_t i = 0; i < TaskCount; ++i)
+      {
+        const auto now = TickSource::Now();
+
+        if (!IsDue(now, releases[i]))
+        {
+          continue;
+        }
+
+        const auto lateness = now - releases[i];
+        auto& taskStatistics = statistics[i];
+
+        if (lateness > taskStatistics.maxJitter)
+        {
+          taskStatistics.maxJitter = lateness;
+        }
+
+        const auto missed = lateness / tasks[i].period;
+        taskStatistics.missedReleases += missed;
+        releases[i] += (missed + 1) * tasks[i].period;
+
+        tasks[i].run(tasks[i].context);
+        ++taskStatistics.runs;
+        ++dispatched;
+      }
+
+      return dispatched;
+    }
+
+    /// @brief Returns the earliest release tick of all tasks.
+    /// @return Tick at which the next task becomes due.
+    uint32_t GetNextRelease() const
+    {
+      auto next = releases[0];
+      const auto now = TickSource::Now();
+
+      for (const auto release : releases)
+      {
+        if (static_cast<int32_t>(release - now) < static_cast<int32_t>(next - now))
+        {
+          next = release;
+        }
+      }
+
+      return next;
+    }
+
+    /// @brief Returns the dispatch statistics of a task.
+    /// @param index Index of the task in the task table.
+    /// @return Dispatch statistics of the task.
+    const TaskStatistics& GetStatistics(const std::size_t index) const
+    {
+      return statistics[index];
+    }
+  };
+}  // namespace Scheduler
+
+#endif  // SCHEDULER_SCHEDULER_HPP
@@ -0,0 +1,216 @@
+/// @file StaticScheduler.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Compile time task table with a static schedulability check.
+/// @details The tasks are given as template parameter pack. Each one declares its period, phase and worst case
+///          execution budget as constexpr members, so the rate monotonic utilization bound is checked by the compiler
+///          and the dispatch calls every `Run()` directly, without function pointers.
+
+#ifndef SCHEDULER_STATICSCHEDULER_HPP
+#define SCHEDULER_STATICSCHEDULER_HPP
+
+#include <Scheduler.hpp>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace Scheduler
+{
+  /// @brief Number of microseconds per tick.
+  constexpr uint32_t MicrosecondsPerTick = 1000;
+
+  /// @brief Task which can be placed in the static task table.
+  /// @details `Period` and `Phase` are given in ticks, `Budget` is the worst case execution time of one release in
+  ///          microseconds.
+  template<class Task>
+  concept PeriodicTask = requires(Task& task) {
+    { Task::Period } -> std::convertible_to<uint32_t>;
+    { Task::Phase } -> std::convertible_to<uint32_t>;
+    { Task::Budget } -> std::convertible_to<uint32_t>;
+    task.Run();
+  } && Task::Period > 0;
+
+  /// @brief Returns the processor utilization of a task set.
+  /// @tparam Tasks Tasks of the set.
+  /// @return Sum of the budgets divided by the periods.
+  template<PeriodicTask... Tasks>
+  constexpr double GetUtilization()
+  {
+    return (0.0 + ... +
+            (static_cast<double>(Tasks::Budget) / (static_cast<double>(Tasks::Period) * MicrosecondsPerTick)));
+  }
+
+  /// @brief Returns the utilization bound of Liu and Layland for rate monotonic scheduling.
+  /// @param taskCount Number of tasks.
+  /// @return n * (2^(1/n) - 1), the root is approximated by bisection.
+  constexpr double GetRateMonotonicBound(const std::size_t taskCount)
+  {
+    auto lower = 1.0;
+    auto upper = 2.0;
+
+    for (auto iteration = 0; iteration < 64; ++iteration)
+    {
+      const auto middle = (lower + upper) / 2.0;
+      auto power = 1.0;
+
+      for (std::size_t i = 0; i < taskCount; ++i)
+      {
+        power *= middle;
+      }
+
+      (power > 2.0 ? upper : lower) = middle;
+    }
+
+    return static_cast<double>(taskCount) * (lower - 1.0);
+  }
+
+  /// @brief Returns whether a task set is schedulable by rate monotonic priorities according to the utilization bound.
+  /// @tparam Tasks Tasks of the set.
+  /// @return True if the utilization does not exceed the bound.
+  template<PeriodicTask... Tasks>
+  constexpr bool IsRateMonotonicSchedulable()
+  {
+    return GetUtilization<Tasks...>() <= GetRateMonotonicBound(sizeof...(Tasks));
+  }
+
+  /// @brief Returns whether the tasks are listed in rate monotonic priority order.
+  /// @tparam Tasks Tasks of the set.
+  /// @return True if no task has a shorter period than the one listed before it.
+  template<PeriodicTask... Tasks>
+  constexpr bool IsRateMonotonicOrder()
+  {
+    constexpr std::array<uint32_t, sizeof...(Tasks)> periods = {Tasks::Period...};
+
+    for (std::size_t i = 1; i < periods.size(); ++i)
+    {
+      if (periods[i] < periods[i - 1])
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief Scheduler dispatching a task set fixed at compile time.
+  /// @tparam TickSource Type providing the current tick by a static `Now()` method.
+  /// @tparam Tasks Tasks in rate monotonic order, the shortest period first.
+  /// @details Behaves like the `CooperativeScheduler`, but the task table is a tuple of references, so every call is
+  ///          known to the compiler and can be inlined.
+  template<class TickSource, PeriodicTask... Tasks>
+  class StaticScheduler
+  {
+   private:
+    /// @brief Number of tasks.
+    static constexpr std::size_t TaskCount = sizeof...(Tasks);
+
+    static_assert(TaskCount > 0, "The scheduler needs at least one task");
+    static_assert(IsRateMonotonicOrder<Tasks...>(), "Tasks have to be listed by period, the shortest one first");
+    static_assert(IsRateMonotonicSchedulable<Tasks...>(), "Task budgets exceed the rate monotonic utilization bound");
+
+    /// @brief Tasks in dispatch order.
+    std::tuple<Tasks&...> tasks;
+
+    /// @brief Next release tick of each task.
+    std::array<uint32_t, TaskCount> releases {};
+
+    /// @brief Dispatch statistics of each task.
+    std::array<TaskStatistics, TaskCount> statistics {};
+
+    /// @brief Dispatches a single task if it is due.
+    /// @tparam Index Index of the task in the table.
+    /// @return True if the task ran.
+    template<std::size_t Index>
+    bool DispatchTask()
+    {
+      using Task = std::tuple_element_t<Index, std::tuple<Tasks...>>;
+      const auto now = TickSource::Now();
+      auto& release = std::get<Index>(releases);
+
+      if (!IsDue(now, release))
+      {
+        return false;
+      }
+
+      const auto lateness = now - release;
+      auto& taskStatistics = std::get<Index>(statistics);
+
+      if (lateness > taskStatistics.maxJitter)
+      {
+        taskStatistics.maxJitter = lateness;
+      }
+
+      const auto missed = lateness / Task::Period;
+      taskStatistics.missedReleases += missed;
+      release += (missed + 1) * Task::Period;
+
+      std::get<Index>(tasks).Run();
+      ++taskStatistics.runs;
+
+      return true;
+    }
+
+   public:
+    /// @brief Processor utilization of the task set.
+    static constexpr double Utilization = GetUtilization<Tasks...>();
+
+    /// @brief Constructor for the StaticScheduler class.
+    /// @param tasks Tasks in dispatch order.
+    /// @details The phase of each task is relative to the tick at construction time.
+    explicit StaticScheduler(Tasks&... tasks) : tasks {tasks...}
+    {
+      const auto start = TickSource::Now();
+      releases = {(start + Tasks::Phase)...};
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    StaticScheduler(const StaticScheduler&) = delete;
+    StaticScheduler& operator=(const StaticScheduler&) = delete;
+    StaticScheduler(StaticScheduler&&) = delete;
+    StaticScheduler& operator=(StaticScheduler&&) = delete;
+    ~StaticScheduler() = default;
+
+    /// @brief Dispatches all tasks which are due.
+    /// @return Number of dispatched tasks.
+    /// @details The tick is sampled again before each task, so time spent in earlier tasks is accounted for. If a task
+    ///          is dispatched more than one period late, the missed releases are skipped instead of run back to back.
+    std::size_t Dispatch()
+    {
+      return [this]<std::size_t... Index>(std::index_sequence<Index...>) {
+        return (std::size_t {0} + ... + static_cast<std::size_t>(DispatchTask<Index>()));
+      }(std::make_index_sequence<TaskCount> {});
+    }
+
+    /// @brief Returns the earliest release tick of all tasks.
+    /// @return Tick at which the next task becomes due.
+    uint32_t GetNextRelease() const
+    {
+      auto next = releases[0];
+      const auto now = TickSource::Now();
+
+      for (const auto release : releases)
+      {
+        if (static_cast<int32_t>(release - now) < static_cast<int32_t>(next - now))
+        {
+          next = release;
+        }
+      }
+
+      return next;
+    }
+
+    /// @brief Returns the dispatch statistics of a task.
+    /// @param index Index of the task in the task table.
+    /// @return Dispatch statistics of the task.
+    const TaskStatistics& GetStatistics(const std::size_t index) const
+    {
+      return statistics[index];
+    }
+  };
+}  // namespace Scheduler
+
+#endif  // SCHEDULER_STATICSCHEDULER_HPP
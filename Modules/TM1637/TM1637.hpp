@@ -4,24 +4,15 @@
 /// @version 1.0
 /// @brief Header file for the TM1637 display driver.
 
-#include <Gpio.hpp>
+#include <Delay.hpp>
 #include <array>
+#include <cstdint>
 
 #ifndef TM1637_TM1637_HPP
 #define TM1637_TM1637_HPP
 
 namespace TM1637
 {
-  /// @brief Structure to hold GPIO pins for the TM1637 display.
-  struct GpioPins
-  {
-    /// @brief GPIO pin for the clock signal.
-    Peripherals::Gpio::Gpio* clockPin;
-
-    /// @brief GPIO pin for the data signal.
-    Peripherals::Gpio::Gpio* dataPin;
-  };
-
   /// @brief Structure to represent time in hours and minutes.
   struct Time
   {
@@ -34,16 +25,15 @@ namespace TM1637
 
   /// @brief Class to control the TM1637 display.
   /// @details This class provides methods to write digits, set brightness, and display time on the TM1637 display.
+  ///          The bit timing takes a few microseconds and is busy waited, so a transfer runs to completion in the
+  ///          calling task. The pins are types, so every edge is a single store.
   /// @note The display supports 4 digits and a colon segment.
+  /// @tparam ClockPin Configured `Peripherals::Gpio::Pin` for the clock signal.
+  /// @tparam DataPin Configured `Peripherals::Gpio::Pin` for the data signal.
+  template<typename ClockPin, typename DataPin>
   class TM1637
   {
    private:
-    /// @brief GPIO pin for the clock signal.
-    Peripherals::Gpio::Gpio* clockPin = nullptr;
-
-    /// @brief GPIO pin for the data signal.
-    Peripherals::Gpio::Gpio* dataPin = nullptr;
-
     /// @brief Brightness level of the display (0-7).
     uint8_t brightness = 4U;
 
@@ -82,32 +72,66 @@ namespace TM1637
     /// @brief Starting address for the display data.
     static constexpr uint8_t startAdress = 0xC0U;
 
-    /// @brief Short delay in milliseconds for timing control.
+    /// @brief Short delay in microseconds for timing control.
     static constexpr uint8_t shortDelay = 2;
 
-    /// @brief Middle delay in milliseconds for timing control.
+    /// @brief Middle delay in microseconds for timing control.
     static constexpr uint8_t middleDelay = 3;
 
-    /// @brief Long delay in milliseconds for timing control.
+    /// @brief Long delay in microseconds for timing control.
     static constexpr uint8_t longDelay = 5;
 
     /// @brief Sends a single byte to the TM1637 display.
     /// @param data The byte to send.
-    void SendByte(uint8_t data);
+    void SendByte(uint8_t data)
+    {
+      for (uint8_t i = 0; i < bitsInByte; ++i)
+      {
+        ClockPin::SetState(false);
+        DataPin::SetState(static_cast<bool>(data & 0x01U));
+        ::Time::DelayMicroseconds(middleDelay);
+        ClockPin::SetState(true);
+        ::Time::DelayMicroseconds(middleDelay);
+        data >>= 1U;
+      }
+    }
 
     /// @brief Starts communication with the TM1637 display.
-    void Start();
+    void Start()
+    {
+      ClockPin::SetState(true);
+      DataPin::SetState(true);
+      ::Time::DelayMicroseconds(shortDelay);
+      DataPin::SetState(false);
+    }
 
     /// @brief Stops communication with the TM1637 display.
-    void Stop();
+    void Stop()
+    {
+      ClockPin::SetState(false);
+      ::Time::DelayMicroseconds(shortDelay);
+      DataPin::SetState(false);
+      ::Time::DelayMicroseconds(shortDelay);
+      ClockPin::SetState(true);
+      ::Time::DelayMicroseconds(shortDelay);
+      DataPin::SetState(true);
+    }
 
     /// @brief Acknowledges the receipt of data from the TM1637 display.
-    void Acknowledge();
+    void Acknowledge()
+    {
+      ClockPin::SetState(false);
+      ::Time::DelayMicroseconds(longDelay);
+      ClockPin::SetState(true);
+      ::Time::DelayMicroseconds(shortDelay);
+      ClockPin::SetState(false);
+    }
 
    public:
     /// @brief Constructor for the TM1637 class.
-    /// @param gpioPins Structure containing GPIO pins for clock and data.
-    TM1637(const GpioPins&& pins);
+    /// @details Nothing is sent yet. Every `WriteDigits()` ends with the brightness command, which also switches the
+    ///          display on, so the first digits are shown with the default brightness.
+    constexpr TM1637() = default;
 
     // Deleted copy constructor and assignment operator.
     TM1637(const TM1637&) = delete;
@@ -119,27 +143,89 @@ namespace TM1637
     /// @brief Writes digits to the TM1637 display.
     /// @param digits Array of 4 digits to display (0-9).
     /// @param colon Flag to indicate if the colon segment should be displayed.
-    void WriteDigits(std::array<uint8_t, 4>& digits, bool colon);
+    void WriteDigits(std::array<uint8_t, 4> digits, bool colon)
+    {
+      // Prepare data for the display
+      digits[0] = digitsToSegments[digits[0]];
+      digits[1] = digitsToSegments[digits[1]] | (colon ? colonSegment : 0U);  // Add colon segment if needed
+      digits[2] = digitsToSegments[digits[2]];
+      digits[3] = digitsToSegments[digits[3]];
+
+      // Set Address command
+      Start();
+      SendByte(addressWithAutoIncrementCommand);
+      Acknowledge();
+      Stop();
+
+      // Send Address and Data
+      Start();
+      SendByte(startAdress);  // Set address to 0xC0 (first digit)
+      Acknowledge();
+
+      for (const auto& digit : digits)
+      {
+        SendByte(digit);
+        Acknowledge();
+      }
+
+      Stop();
+      SetBrightness(brightness);
+    }
 
     /// @brief Sets the brightness of the TM1637 display.
     /// @param brightness Brightness level (0-7).
     /// @details The brightness level is set using a command that combines the set brightness command with the desired
     /// level.
     /// @note The brightness level is capped at 7 (maximum).
-    void SetBrightness(uint8_t brightness);
+    void SetBrightness(uint8_t brightness)
+    {
+      this->brightness = brightness;
+      Start();
+      SendByte(setBrightnessCommand | static_cast<uint8_t>(brightness & maxBrightness));
+      Acknowledge();
+      Stop();
+    }
 
     /// @brief Sets the counter value on the TM1637 display.
     /// @param counter The counter value to display (0-9999).
     /// @details The counter value is split into its individual digits and displayed on the TM1637.
     /// @note The counter value is expected to be in the range of 0 to 9999.
     /// @note If the counter exceeds 9999, it will wrap around to 0.
-    void SetCounter(uint16_t counter);
+    void SetCounter(uint16_t counter)
+    {
+      std::array<uint8_t, 4> digits = {0, 0, 0, 0};
+      constexpr auto thousandsDivisor = 1000U;
+      constexpr auto hundredsDivisor = 100U;
+      constexpr auto tensDivisor = 10U;
+      constexpr auto digitsDivisor = 10U;
+
+      // Convert counter to digits
+      digits[0] = (counter / thousandsDivisor) % digitsDivisor;  // Thousands
+      digits[1] = (counter / hundredsDivisor) % digitsDivisor;   // Hundreds
+      digits[2] = (counter / tensDivisor) % digitsDivisor;       // Tens
+      digits[3] = counter % digitsDivisor;                       // Units
+
+      WriteDigits(digits, false);
+    }
 
     /// @brief Sets the current time on the TM1637 display.
     /// @param time The time to display, represented as a Time structure containing hours and minutes.
     /// @details The time is displayed in a 24-hour format, with hours ranging from 0 to 23 and minutes from 0 to 59.
     /// @note The display will show the time in the format HH:MM.
-    void SetClock(Time& time);
+    void SetClock(Time time)
+    {
+      std::array<uint8_t, 4> digits = {0, 0, 0, 0};
+      constexpr auto digitsDivisor = 10U;
+
+      // Convert hours and minutes to digits
+      digits[0] = (time.hours / digitsDivisor) % digitsDivisor;    // Tens of hours
+      digits[1] = time.hours % digitsDivisor;                      // Units of hours
+      digits[2] = (time.minutes / digitsDivisor) % digitsDivisor;  // Tens of minutes
+      digits[3] = time.minutes % digitsDivisor;                    // Units of minutes
+      colonEnabled = !colonEnabled;                                // Toggle colon state for clock display
+
+      WriteDigits(digits, colonEnabled);  // Add colon for clock display
+    }
   };
 }  // namespace TM1637
 
@@ -1,5 +1,9 @@
-#include <Gpio.hpp>
+#include <Calendar.hpp>
+#include <Coroutine.hpp>
+#include <Pin.hpp>
+#include <Rtc.hpp>
 #include <TM1637.hpp>
+#include <cstdint>
 
 #ifndef TASKS_DISPLAY_HPP
 #define TASKS_DISPLAY_HPP
@@ -7,51 +11,71 @@
 namespace Tasks::Display
 {
   /// @brief DisplayTask class that manages the display of time on a TM1637 display.
+  /// @details The time is kept by the real time clock, its alarm signals the change of the minute. Unlike the seconds
+  ///          interrupt, the alarm wakes the core from Stop mode, so the display stays current in every power state.
   class DisplayTask
   {
    private:
-    /// @brief Pin number for the clock signal of the TM1637 display.
-    static constexpr auto DisplayClockPin = 10;
+    /// @brief Pin for the clock signal of the TM1637 display.
+    using ClockPin = Peripherals::Gpio::Pin<GPIOB_BASE, 10>;
 
-    /// @brief Pin number for the data signal of the TM1637 display.
-    static constexpr auto DisplayDataPin = 11;
+    /// @brief Pin for the data signal of the TM1637 display.
+    using DataPin = Peripherals::Gpio::Pin<GPIOB_BASE, 11>;
 
-    /// @brief Number of seconds in a minute and minutes in an hour.
-    static constexpr auto SecondsAndMinutes = 60U;
-
-    /// @brief Number of hours in a day.
-    static constexpr auto Hours = 24U;
-
-    /// @brief Seconds counter to keep track of the time.
-    uint8_t seconds = 0U;
-
-    /// @brief Clock structure to hold the current time in hours and minutes.
+    /// @brief Clock structure to hold the displayed time in hours and minutes.
     TM1637::Time clock = TM1637::Time {
       .hours = 0,
       .minutes = 0,
     };
 
     /// @brief Pin configuration for clock pin of the TM1637 display.
-    Peripherals::Gpio::Gpio clockPin = Peripherals::Gpio::Gpio(GPIOB,
-      DisplayClockPin,
-      Peripherals::Gpio::Mode::OutputLow,
-      Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
+    [[no_unique_address]] ClockPin clockPin =
+      ClockPin(Peripherals::Gpio::Mode::OutputLow, Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
 
     /// @brief Pin configuration for data pin of the TM1637 display.
-    Peripherals::Gpio::Gpio dataPin = Peripherals::Gpio::Gpio(GPIOB,
-      DisplayDataPin,
-      Peripherals::Gpio::Mode::OutputLow,
-      Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
+    [[no_unique_address]] DataPin dataPin =
+      DataPin(Peripherals::Gpio::Mode::OutputLow, Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
+
+    /// @brief TM1637 display instance driving the configured GPIO pins.
+    TM1637::TM1637<ClockPin, DataPin> display;
+
+    /// @brief Event set whenever the clock changed and the display has to be refreshed.
+    Scheduler::Event clockChanged;
 
-    /// @brief TM1637 display instance with the configured GPIO pins.
-    TM1637::TM1637 display = TM1637::TM1637(TM1637::GpioPins {
-      .clockPin = &clockPin,
-      .dataPin = &dataPin,
-    });
+    /// @brief Signals a refresh and sets the alarm for the next minute.
+    /// @param context Display task.
+    /// @param counter RTC counter in seconds.
+    static void OnMinute(void* context, const uint32_t counter)
+    {
+      auto& task = *static_cast<DisplayTask*>(context);
+
+      SetNextAlarm(counter, task);
+      task.clockChanged.Set();
+    }
+
+    /// @brief Sets the RTC alarm to the start of the next minute.
+    /// @param counter Current RTC counter in seconds.
+    /// @param task Display task.
+    static void SetNextAlarm(const uint32_t counter, DisplayTask& task)
+    {
+      const auto nextMinute = ((counter / ::Time::SecondsPerMinute) + 1) * ::Time::SecondsPerMinute;
+      Peripherals::Rtc::RealTimeClock::GetInstance().SetAlarm(nextMinute, OnMinute, &task);
+    }
 
    public:
+    /// @brief Worst case execution time of a display refresh in microseconds.
+    static constexpr uint32_t Budget = 2000;
+
     /// @brief Constructor for the DisplayTask class.
-    DisplayTask() = default;
+    /// @details Starts the real time clock and shows the current time right away.
+    DisplayTask()
+    {
+      auto& rtc = Peripherals::Rtc::RealTimeClock::GetInstance();
+      rtc.Init();
+
+      clockChanged.Set();
+      SetNextAlarm(rtc.GetCounter(), *this);
+    }
 
     // Deleted copy and move constructors and assignment operators.
     DisplayTask(const DisplayTask&) = delete;
@@ -60,29 +84,25 @@ namespace Tasks::Display
     DisplayTask& operator=(DisplayTask&&) = delete;
     ~DisplayTask() = default;
 
-    /// @brief Runs the display task to update the clock every second.
-    void Run()
+    /// @brief Refreshes the display whenever the clock changed.
+    /// @return Coroutine task, which never completes.
+    /// @details The refresh runs outside the RTC interrupt, so the transfer of about half a millisecond of busy waited
+    ///          bit timing delays no other interrupt. The time is read when the refresh starts, so a late refresh shows
+    ///          the current minute.
+    Scheduler::Task Refresh()
     {
-      ++seconds;
-
-      if (seconds >= SecondsAndMinutes)
+      for (;;)
       {
-        seconds = 0U;
-        ++clock.minutes;
-
-        if (clock.minutes >= SecondsAndMinutes)
-        {
-          clock.minutes = 0U;
-          ++clock.hours;
-
-          if (clock.hours >= Hours)
-          {
-            clock.hours = 0U;
-          }
-        }
-      }
+        co_await clockChanged;
 
-      display.SetClock(clock);
+        const auto now = ::Time::ToDateTime(Peripherals::Rtc::RealTimeClock::GetInstance().GetCounter());
+        clock = TM1637::Time {
+          .hours = now.hours,
+          .minutes = now.minutes,
+        };
+
+        display.SetClock(clock);
+      }
     }
   };
 }  // namespace Tasks::Display
@@ -0,0 +1,95 @@
+#include <Exti.hpp>
+#include <InputWatch.hpp>
+#include <TimerService.hpp>
+#include <bit>
+#include <cstdint>
+
+#ifndef TASKS_INPUTS_HPP
+#define TASKS_INPUTS_HPP
+
+namespace Tasks::Inputs
+{
+  /// @brief Watch of the ports with the switches and the push button, one subscription per task.
+  using WatchType = Input::InputWatch<4, GPIOA_BASE, GPIOB_BASE>;
+
+  /// @brief Watched inputs, whose debounced states the tasks read instead of the input data registers.
+  /// @details Constant initialized, so the tasks constructed before the inputs task may subscribe to it.
+  inline constinit WatchType inputWatch {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  /// @brief Samples the watched ports and stops the timer once all pins are stable.
+  /// @param context Sample timer.
+  inline void OnSample(void* context)
+  {
+    if (!inputWatch.Sample())
+    {
+      Timers::timerService.Stop(*static_cast<Timers::Timer*>(context));
+    }
+  }
+
+  /// @brief Timer sampling the watched ports while a pin changes, its callback runs in the SysTick interrupt.
+  inline constinit Timers::Timer sampleTimer =  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    Timers::Timer(OnSample, &sampleTimer);
+
+  /// @brief Starts the sampling on an edge of a watched pin, the handler of the EXTI lines of the pins.
+  /// @param context Unused.
+  /// @param line Line which saw an edge.
+  inline void OnEdge([[maybe_unused]] void* context, [[maybe_unused]] const uint32_t line)
+  {
+    if (inputWatch.OnEdge())
+    {
+      Timers::timerService.Start(sampleTimer, WatchType::SamplePeriod, WatchType::SamplePeriod);
+    }
+  }
+
+  /// @brief Subscribes to debounced edges of pins and routes their EXTI lines to the port.
+  /// @tparam PortBase Base address of the port.
+  /// @param mask Mask of the pins, their lines must not be used by another port or by another interrupt.
+  /// @param callback Callback invoked in the SysTick interrupt from the sample confirming an edge.
+  /// @param context Context passed to the callback.
+  /// @return True if subscribed, false if all subscriptions are used.
+  template<uintptr_t PortBase>
+  bool Subscribe(const uint16_t mask, const Input::ChangeCallback callback, void* context)
+  {
+    constexpr auto port = static_cast<Peripherals::Exti::ExtiPort>((PortBase - GPIOA_BASE) / (GPIOB_BASE - GPIOA_BASE));
+
+    if (!inputWatch.Subscribe<PortBase>(mask, callback, context))
+    {
+      return false;
+    }
+
+    for (auto pins = static_cast<uint32_t>(mask); pins != 0; pins &= pins - 1)
+    {
+      const auto line = static_cast<uint32_t>(std::countr_zero(pins));
+      Peripherals::Exti::ExternalInterruptManager::Attach(line, OnEdge, nullptr);
+      Peripherals::Exti::ExternalInterruptManager::Configure(line, port, Peripherals::Exti::Edge::Both);
+    }
+
+    return true;
+  }
+
+  /// @brief InputsTask class that takes the initial states of the watched pins.
+  /// @details An edge of a subscribed pin starts a timer sampling all watched ports every
+  ///          `WatchType::SamplePeriod` ms, it is stopped again once all pins are stable. With
+  ///          `Input::VerticalCounter::StableSamples` samples, a level has to be stable for 15 to 20 ms. While no pin
+  ///          changes, the inputs cost no time at all.
+  class InputsTask
+  {
+   public:
+    /// @brief Constructor for the InputsTask class.
+    /// @details Constructed after the tasks configuring and subscribing to the pins, whose levels are taken as initial
+    ///          states.
+    InputsTask()
+    {
+      inputWatch.Prime();
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    InputsTask(const InputsTask&) = delete;
+    InputsTask& operator=(const InputsTask&) = delete;
+    InputsTask(InputsTask&&) = delete;
+    InputsTask& operator=(InputsTask&&) = delete;
+    ~InputsTask() = default;
+  };
+}  // namespace Tasks::Inputs
+
+#endif  // TASKS_INPUTS_HPP
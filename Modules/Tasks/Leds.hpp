@@ -1,13 +1,16 @@
-#include <Gpio.hpp>
+#include <Coroutine.hpp>
+#include <Inputs.hpp>
+#include <PinGroup.hpp>
+#include <cstdint>
 
 #ifndef TASKS_LEDS_HPP
 #define TASKS_LEDS_HPP
 
-using GpioType = Peripherals::Gpio::Gpio;
-
 namespace Tasks::Leds
 {
   /// @brief LedsTask class that manages the state of two LEDs based on the state of two switches.
+  /// @details The task subscribes to the debounced edges of the switches and sleeps until one of them moves, so the
+  ///          LEDs follow a switch right after its debounce time and are not written while nothing changes.
   class LedsTask
   {
    private:
@@ -23,34 +26,46 @@ namespace Tasks::Leds
     /// @brief Pin number for the switch controlling the red LED.
     static constexpr auto SwitchRedLedPin = 15;
 
-    /// @brief GPIO configuration for the green LED.
-    GpioType greenLed = GpioType(
-      GPIOB, GreenLedPin, Peripherals::Gpio::Mode::OutputLow, Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
+    /// @brief Both LEDs, written with a single store.
+    using LedPins = Peripherals::Gpio::PinGroup<GPIOB_BASE, GreenLedPin, RedLedPin>;
 
-    /// @brief GPIO configuration for the red LED.
-    GpioType redLed = GpioType(
-      GPIOB, RedLedPin, Peripherals::Gpio::Mode::OutputLow, Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
+    /// @brief Both switches, debounced by the inputs task.
+    using SwitchPins = Peripherals::Gpio::PinGroup<GPIOA_BASE, SwitchGreenLedPin, SwitchRedLedPin>;
 
-    /// @brief GPIO configuration for the switch controlling the green LED.
-    GpioType switchGreenLed = GpioType(
-      GPIOA, SwitchGreenLedPin, Peripherals::Gpio::Mode::Input, Peripherals::Gpio::InputOutputType::Floating_OpenDrain);
+    /// @brief GPIO configuration for the LEDs.
+    [[no_unique_address]] LedPins leds =
+      LedPins(Peripherals::Gpio::Mode::OutputLow, Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
 
-    /// @brief GPIO configuration for the switch controlling the red LED.
-    GpioType switchRedLed = GpioType(GPIOA,
-      SwitchRedLedPin,
-      Peripherals::Gpio::Mode::Input,
+    /// @brief GPIO configuration for the switches, PA15 is a JTAG pin after reset.
+    [[no_unique_address]] SwitchPins switches = SwitchPins(Peripherals::Gpio::Mode::Input,
       Peripherals::Gpio::InputOutputType::Floating_OpenDrain,
       {
         .afioMask = AFIO_MAPR_SWJ_CFG_Msk,
         .afioMode = AFIO_MAPR_SWJ_CFG_JTAGDISABLE,
       });
 
+    /// @brief Event set whenever a switch changed its debounced state.
+    Scheduler::Event switchesChanged;
+
+    /// @brief Signals a refresh of the LEDs, called from the sample confirming an edge of a switch.
+    /// @param context LEDs task.
+    /// @param changed Switches which changed.
+    static void OnSwitchesChanged(void* context, [[maybe_unused]] const uint16_t changed)
+    {
+      static_cast<LedsTask*>(context)->switchesChanged.Set();
+    }
+
    public:
+    /// @brief Worst case execution time of a refresh in microseconds.
+    static constexpr uint32_t Budget = 20;
+
     /// @brief Constructor for the LedsTask class.
+    /// @details Switches the LEDs on until the first refresh shows the switches.
     LedsTask()
     {
-      greenLed.SetState(true);
-      redLed.SetState(true);
+      LedPins::Set();
+      Inputs::Subscribe<GPIOA_BASE>(SwitchPins::Mask, OnSwitchesChanged, this);
+      switchesChanged.Set();
     }
 
     // Deleted copy and move constructors and assignment operators.
@@ -60,11 +75,18 @@ namespace Tasks::Leds
     LedsTask& operator=(LedsTask&&) = delete;
     ~LedsTask() = default;
 
-    /// @brief Runs the LedsTask, updating the state of the LEDs based on the switches.
-    void Run()
+    /// @brief Updates the state of the LEDs whenever a switch changed.
+    /// @return Coroutine task, which never completes.
+    Scheduler::Task Refresh()
     {
-      greenLed.SetState(switchGreenLed.GetState());
-      redLed.SetState(switchRedLed.GetState());
+      for (;;)
+      {
+        co_await switchesChanged;
+
+        const auto states = Inputs::inputWatch.GetDebouncer().GetState<GPIOA_BASE>();
+        LedPins::Write((((states >> SwitchGreenLedPin) & 1U) << GreenLedPin) |
+                       (((states >> SwitchRedLedPin) & 1U) << RedLedPin));
+      }
     }
   };
 }  // namespace Tasks::Leds
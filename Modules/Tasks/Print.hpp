@@ -1,8 +1,25 @@
+#include <BootProfiler.hpp>
+#include <Coroutine.hpp>
+#include <CriticalSection.hpp>
+#include <Delay.hpp>
+#include <Dwt.hpp>
+#include <Events.hpp>
+#include <Exti.hpp>
 #include <Gpio.hpp>
+#include <Inputs.hpp>
+#include <InterruptManager.hpp>
+#include <Log.hpp>
+#include <Pin.hpp>
+#include <PowerManager.hpp>
 #include <Rcc.hpp>
 #include <TM1637.hpp>
+#include <TaskProfiler.hpp>
+#include <TimerService.hpp>
 #include <Usart.hpp>
-#include <Exti.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 
 #ifndef TASKS_PRINT_HPP
@@ -23,22 +40,238 @@ namespace Tasks::Print
     /// @brief Baud rate for the USART communication.
     static constexpr auto BaudRate = 115200;
 
-    /// @brief Pin number for the push button.
-    static constexpr auto PushButtonPin = 0;
+    /// @brief Pin of the push button.
+    using PushButtonPin = Peripherals::Gpio::Pin<GPIOA_BASE, 0>;
+
+    /// @brief Line of the EXTI connected to the receive pin PA10 of USART1.
+    static constexpr uint32_t ReceiveLine = 10;
+
+    /// @brief Ticks without a received character after which the console session ends and Stop is allowed again.
+    static constexpr uint32_t ConsoleSessionTicks = 30'000;
+
+    /// @brief Number of the unused pin toggled by the GPIO benchmark.
+    static constexpr auto BenchmarkPinNumber = 12;
+
+    /// @brief Unused pin toggled by the GPIO benchmark.
+    using BenchmarkPin = Peripherals::Gpio::Pin<GPIOB_BASE, BenchmarkPinNumber>;
+
+    /// @brief Character requesting the task profile over USART1.
+    static constexpr uint16_t ProfileCommand = 'p';
+
+    /// @brief Character requesting the delay benchmark over USART1.
+    static constexpr uint16_t DelayBenchmarkCommand = 'd';
+
+    /// @brief Character switching to the low clock profile over USART1.
+    static constexpr uint16_t LowClockCommand = 'l';
+
+    /// @brief Character switching to the high clock profile over USART1.
+    static constexpr uint16_t HighClockCommand = 'h';
+
+    /// @brief Character requesting the boot milestones over USART1.
+    static constexpr uint16_t BootReportCommand = 'b';
+
+    /// @brief Character requesting the power state residency over USART1.
+    static constexpr uint16_t PowerReportCommand = 's';
+
+    /// @brief Character requesting the GPIO benchmark over USART1.
+    static constexpr uint16_t GpioBenchmarkCommand = 'g';
+
+    /// @brief Character requesting the interrupt entry latency over USART1.
+    static constexpr uint16_t LatencyCommand = 'v';
 
     /// @brief Push button GPIO configuration.
-    GpioType pushButton = GpioType(
-      GPIOA, PushButtonPin, Peripherals::Gpio::Mode::Input, Peripherals::Gpio::InputOutputType::Floating_OpenDrain);
+    [[no_unique_address]] PushButtonPin pushButton =
+      PushButtonPin(Peripherals::Gpio::Mode::Input, Peripherals::Gpio::InputOutputType::Floating_OpenDrain);
+
+    /// @brief Benchmark pin driven through the runtime `Gpio`, configured once so the benchmark only times the writes.
+    /// @details The `Pin` of the benchmark drives the same pin, it needs no configuration of its own.
+    GpioType benchmarkGpio = GpioType(GPIOB,
+      BenchmarkPinNumber,
+      Peripherals::Gpio::Mode::OutputLow,
+      Peripherals::Gpio::InputOutputType::AnalogMode_PushPull);
+
+    /// @brief Timer ending the console session, its callback runs in the SysTick interrupt.
+    Timers::Timer sessionTimer = Timers::Timer(OnSessionEnd, nullptr);
+
+    /// @brief Prints the execution time statistics of the tasks and the usage of the coroutine frames.
+    /// @details A coroutine whose frame could not be allocated never runs, so the failures are always printed.
+    static void ReportProfile()
+    {
+      if constexpr (Profiling::Enabled)
+      {
+        Profiling::taskProfiler.Report();
+      }
+      else
+      {
+        printf("Task profiling is disabled\n");
+      }
+
+      printf("frames %u of %u used, high water %u, %lu failed\n",
+        static_cast<unsigned>(Scheduler::frameArena.GetUsedBlocks()),
+        static_cast<unsigned>(Scheduler::FrameBlockCount),
+        static_cast<unsigned>(Scheduler::frameArena.GetHighWater()),
+        static_cast<unsigned long>(Scheduler::frameArena.GetFailures()));
+    }
+
+    /// @brief Measures the busy waiting delays with the cycle counter and prints the deviation.
+    /// @details Interrupts during a measurement extend the delay, so the benchmark is repeated and the shortest
+    ///          measurement is printed.
+    static void BenchmarkDelays()
+    {
+      constexpr std::array<uint32_t, 4> durations = {1, 5, 10, 100};
+      constexpr auto repetitions = 8;
+
+      printf("delay   cycles  measured\n");
+
+      for (const auto microseconds : durations)
+      {
+        auto shortest = UINT32_MAX;
+
+        for (auto i = 0; i < repetitions; ++i)
+        {
+          const auto start = Peripherals::Dwt::CycleCounter::Now();
+          Time::DelayMicroseconds(microseconds);
+          shortest = std::min<uint32_t>(shortest, Peripherals::Dwt::CycleCounter::Now() - start);
+        }
+
+        printf("%3lu us %8lu %9lu\n",
+          static_cast<unsigned long>(microseconds),
+          static_cast<unsigned long>(Time::MicrosecondsToCycles(microseconds)),
+          static_cast<unsigned long>(shortest));
+      }
+    }
+
+    /// @brief Measures the cycles of setting a pin through the runtime `Gpio` and the compile time `Pin` and prints them.
+    /// @details Both drive the same unused pin. The `Pin` store is inlined, the `Gpio` call loads the port and the mask
+    ///          from the object. The shortest of several measurements is printed, like for the delays.
+    void BenchmarkGpio() const
+    {
+      constexpr auto writes = 16U;
+      constexpr auto repetitions = 8;
+
+      auto shortestGpio = UINT32_MAX;
+      auto shortestPin = UINT32_MAX;
+
+      for (auto i = 0; i < repetitions; ++i)
+      {
+        auto start = Peripherals::Dwt::CycleCounter::Now();
+
+        for (auto write = 0U; write < writes; ++write)
+        {
+          benchmarkGpio.SetState((write & 1U) == 0);
+        }
+
+        shortestGpio = std::min<uint32_t>(shortestGpio, Peripherals::Dwt::CycleCounter::Now() - start);
+        start = Peripherals::Dwt::CycleCounter::Now();
+
+        for (auto write = 0U; write < writes; ++write)
+        {
+          BenchmarkPin::SetState((write & 1U) == 0);
+        }
+
+        shortestPin = std::min<uint32_t>(shortestPin, Peripherals::Dwt::CycleCounter::Now() - start);
+      }
+
+      printf("gpio   %3lu cycles per write\n", static_cast<unsigned long>(shortestGpio / writes));
+      printf("pin    %3lu cycles per write\n", static_cast<unsigned long>(shortestPin / writes));
+    }
+
+    /// @brief Measures the interrupt entry latency with the vector table in flash and in RAM and prints it.
+    static void ReportEntryLatency()
+    {
+      const auto latency = Peripherals::InterruptManager::MeasureEntryLatency();
+      printf("flash vectors %3lu cycles\n", static_cast<unsigned long>(latency.flash));
+      printf("ram vectors   %3lu cycles\n", static_cast<unsigned long>(latency.ram));
+    }
+
+    /// @brief Switches the system clock and prints the new frequency and the duration of the switch.
+    /// @param profile Clock profile to switch to.
+    static void SwitchClock(const Peripherals::Rcc::ClockProfile profile)
+    {
+      auto& rcc = RccType::GetInstance();
+      rcc.SetSystemClock(profile);
+
+      const auto& statistics = rcc.GetClockSwitchStatistics();
+      printf("%lu MHz, switch took %lu cycles, max %lu\n",
+        static_cast<unsigned long>(rcc.GetClocks().systemClock / 1'000'000),
+        static_cast<unsigned long>(statistics.lastLatency),
+        static_cast<unsigned long>(statistics.maxLatency));
+    }
+
+    /// @brief Logs a press of the push button, called in the SysTick interrupt.
+    /// @param context Unused.
+    /// @param changed Unused, the push button is the only subscribed pin.
+    static void OnButtonChanged([[maybe_unused]] void* context, [[maybe_unused]] const uint16_t changed)
+    {
+      if (Inputs::inputWatch.GetDebouncer().TakePressed<GPIOA_BASE>(PushButtonPin::Mask) != 0)
+      {
+        Logging::Log("Hello World!\n");
+      }
+    }
+
+    /// @brief Starts a console session on the start bit of a character, the handler of the EXTI line of PA10.
+    /// @param context Print task.
+    /// @param line Unused, the receive line is the only one attached.
+    /// @details Stop gates the USART1 clock, so the character waking the core from Stop is lost. The session inhibits
+    ///          Stop until no character was received for `ConsoleSessionTicks`. The line is masked meanwhile, so the
+    ///          following start bits do not interrupt, and the inhibit cannot be taken twice.
+    static void OnReceiveEdge(void* context, [[maybe_unused]] const uint32_t line)
+    {
+      auto& task = *static_cast<PrintTask*>(context);
+
+      Peripherals::Exti::ExternalInterruptManager::Disable(ReceiveLine);
+      Power::PowerManager::GetInstance().Inhibit(Power::PowerState::Stop);
+      Timers::timerService.Start(task.sessionTimer, ConsoleSessionTicks);
+    }
+
+    /// @brief Ends the console session, allows Stop again and rearms the receive line.
+    /// @param context Unused.
+    static void OnSessionEnd([[maybe_unused]] void* context)
+    {
+      Power::PowerManager::GetInstance().Release(Power::PowerState::Stop);
+      Peripherals::Exti::ExternalInterruptManager::Configure(
+        ReceiveLine, Peripherals::Exti::ExtiPort::PortA, Peripherals::Exti::Edge::Falling);
+    }
+
+    /// @brief Extends the console session after a received character.
+    /// @details The timer is only restarted while it runs, under the kernel lock so it cannot expire in between and
+    ///          release the inhibit twice.
+    void ExtendSession()
+    {
+      const Peripherals::KernelLock lock;
+
+      if (sessionTimer.IsActive())
+      {
+        Timers::timerService.Start(sessionTimer, ConsoleSessionTicks);
+      }
+    }
+
+    /// @brief Transmits a formatted log line over USART1.
+    /// @param context Unused.
+    /// @param line Formatted line.
+    /// @param length Length of the line.
+    static void WriteLogLine([[maybe_unused]] void* context, const char* line, const std::size_t length)
+    {
+      fwrite(line, 1, length, stdout);
+    }
 
    public:
     /// @brief Constructor for the PrintTask class.
-    /// @details Configures the USART1 peripheral with the specified baud rate.
+    /// @details Configures the USART1 peripheral with the specified baud rate, which is kept across clock switches.
     PrintTask()
     {
-      UsartType::GetInstance<Usart::UsartInstance::Usart1>().Configure(
-        USART1, UsartType::GetMantissaAndFraction(BaudRate, RccType::Ticks));
+      auto& usart = UsartType::GetInstance<Usart::UsartInstance::Usart1>();
+      constexpr auto clockInTicks = UsartType::GetClockInTicks<Usart::UsartInstance::Usart1>();
+      usart.Configure(USART1, UsartType::GetMantissaAndFraction(BaudRate, clockInTicks));
+      usart.EnableReceiver();
+      RccType::GetInstance().AddClockListener(UsartType::HandleClockChange, &usart);
 
-      Peripherals::Exti::ExternalInterruptManager::SetupExti0Interrupt(Peripherals::Exti::ExtiPort::PortA);
+      // The receive pin is configured by the USART, its falling start bit edge starts a console session
+      Peripherals::Exti::ExternalInterruptManager::Attach(ReceiveLine, OnReceiveEdge, this);
+      Peripherals::Exti::ExternalInterruptManager::Configure(
+        ReceiveLine, Peripherals::Exti::ExtiPort::PortA, Peripherals::Exti::Edge::Falling);
+
+      Inputs::Subscribe<GPIOA_BASE>(PushButtonPin::Mask, OnButtonChanged, nullptr);
     }
 
     // Deleted copy constructor and assignment operator.
@@ -49,13 +282,51 @@ namespace Tasks::Print
     ~PrintTask() = default;
 
     /// @brief Runs the print task.
+    /// @details Drains the events posted by the interrupt handlers and transmits the log records they wrote. Runs in
+    ///          its own thread whenever the interrupt signal is set, preempting the long running tasks.
     void Run()
     {
-      // Done by exti
-      // if (pushButton.GetState())
-      // {
-      //   printf("Hello World!\n");
-      // }
+      while (const auto event = Events::interruptEvents.Pop())
+      {
+        if (event->type != Events::EventType::CharacterReceived)
+        {
+          continue;
+        }
+
+        ExtendSession();
+
+        switch (event->data)
+        {
+          case ProfileCommand:
+            ReportProfile();
+            break;
+          case DelayBenchmarkCommand:
+            BenchmarkDelays();
+            break;
+          case LowClockCommand:
+            SwitchClock(Peripherals::Rcc::ClockProfile::Low);
+            break;
+          case HighClockCommand:
+            SwitchClock(Peripherals::Rcc::ClockProfile::High);
+            break;
+          case BootReportCommand:
+            Profiling::bootProfiler.Report();
+            break;
+          case PowerReportCommand:
+            Power::PowerManager::GetInstance().Report();
+            break;
+          case GpioBenchmarkCommand:
+            BenchmarkGpio();
+            break;
+          case LatencyCommand:
+            ReportEntryLatency();
+            break;
+          default:
+            break;
+        }
+      }
+
+      Logging::deferredLog.Flush(WriteLogLine, nullptr);
     }
   };
 }  // namespace Tasks::Print
@@ -0,0 +1,109 @@
+/// @file Calendar.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Conversion between the seconds counted by the real time clock and the civil date and time.
+/// @details The counter holds the seconds since 1970-01-01 00:00:00, its 32 bits last until 2106. The days are
+///          converted with the proleptic Gregorian calendar, counting the years from March on, so the leap day is the
+///          last day of a year and needs no special case.
+
+#ifndef TIME_CALENDAR_HPP
+#define TIME_CALENDAR_HPP
+
+#include <cstdint>
+
+namespace Time
+{
+  /// @brief Seconds per minute.
+  constexpr uint32_t SecondsPerMinute = 60;
+
+  /// @brief Seconds per hour.
+  constexpr uint32_t SecondsPerHour = 60 * SecondsPerMinute;
+
+  /// @brief Seconds per day.
+  constexpr uint32_t SecondsPerDay = 24 * SecondsPerHour;
+
+  /// @brief Civil date and time.
+  struct DateTime
+  {
+    /// @brief Year, 1970 to 2106.
+    uint16_t year;
+
+    /// @brief Month, 1 to 12.
+    uint8_t month;
+
+    /// @brief Day of the month, 1 to 31.
+    uint8_t day;
+
+    /// @brief Hours, 0 to 23.
+    uint8_t hours;
+
+    /// @brief Minutes, 0 to 59.
+    uint8_t minutes;
+
+    /// @brief Seconds, 0 to 59.
+    uint8_t seconds;
+
+    constexpr bool operator==(const DateTime&) const = default;
+  };
+
+  namespace Detail
+  {
+    /// @brief Days per 400 years.
+    constexpr uint32_t DaysPerEra = 146097;
+
+    /// @brief Days from 0000-03-01 to 1970-01-01.
+    constexpr uint32_t EpochDays = 719468;
+  }  // namespace Detail
+
+  /// @brief Converts a date to the days since 1970-01-01.
+  /// @param year Year, from 1970 on.
+  /// @param month Month, 1 to 12.
+  /// @param day Day of the month, 1 to 31.
+  /// @return Days since 1970-01-01.
+  constexpr uint32_t DaysFromCivil(uint32_t year, const uint32_t month, const uint32_t day)
+  {
+    year -= month <= 2 ? 1U : 0U;
+    const auto era = year / 400;
+    const auto yearOfEra = year - (era * 400);
+    const auto dayOfYear = (((153 * (month > 2 ? month - 3 : month + 9)) + 2) / 5) + day - 1;
+    const auto dayOfEra = (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+
+    return (era * Detail::DaysPerEra) + dayOfEra - Detail::EpochDays;
+  }
+
+  /// @brief Converts the seconds since 1970-01-01 00:00:00 to the civil date and time.
+  /// @param counter Seconds since 1970-01-01 00:00:00.
+  /// @return Date and time.
+  constexpr DateTime ToDateTime(const uint32_t counter)
+  {
+    const auto secondOfDay = counter % SecondsPerDay;
+    const auto days = (counter / SecondsPerDay) + Detail::EpochDays;
+    const auto era = days / Detail::DaysPerEra;
+    const auto dayOfEra = days - (era * Detail::DaysPerEra);
+    const auto yearOfEra = (dayOfEra - (dayOfEra / 1460) + (dayOfEra / 36524) - (dayOfEra / 146096)) / 365;
+    const auto dayOfYear = dayOfEra - ((365 * yearOfEra) + (yearOfEra / 4) - (yearOfEra / 100));
+    const auto monthFromMarch = ((5 * dayOfYear) + 2) / 153;
+    const auto month = monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9;
+
+    return DateTime {
+      .year = static_cast<uint16_t>(yearOfEra + (era * 400) + (month <= 2 ? 1U : 0U)),
+      .month = static_cast<uint8_t>(month),
+      .day = static_cast<uint8_t>(dayOfYear - (((153 * monthFromMarch) + 2) / 5) + 1),
+      .hours = static_cast<uint8_t>(secondOfDay / SecondsPerHour),
+      .minutes = static_cast<uint8_t>((secondOfDay % SecondsPerHour) / SecondsPerMinute),
+      .seconds = static_cast<uint8_t>(secondOfDay % SecondsPerMinute),
+    };
+  }
+
+  /// @brief Converts the civil date and time to the seconds since 1970-01-01 00:00:00.
+  /// @param dateTime Date and time, from 1970 to 2106-02-07 06:28:15.
+  /// @return Seconds since 1970-01-01 00:00:00.
+  constexpr uint32_t ToCounter(const DateTime& dateTime)
+  {
+    return (DaysFromCivil(dateTime.year, dateTime.month, dateTime.day) * SecondsPerDay) +
+           (dateTime.hours * SecondsPerHour) + (dateTime.minutes * SecondsPerMinute) + dateTime.seconds;
+  }
+}  // namespace Time
+
+#endif  // TIME_CALENDAR_HPP
@@ -0,0 +1,87 @@
+/// @file Delay.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Busy waiting delays with cycle resolution for bit banged protocols.
+/// @details The delays count core clock cycles with the DWT cycle counter, so they keep their length independent of
+///          the flash wait states and of interrupts, which only extend them. Durations are converted to cycles at
+///          compile time whenever they are constant, rounding up so a delay is never shorter than requested. The
+///          conversion assumes the high clock profile, in the low profile the delays last longer accordingly.
+
+#ifndef TIME_DELAY_HPP
+#define TIME_DELAY_HPP
+
+#include <Dwt.hpp>
+#include <Rcc.hpp>
+#include <chrono>
+#include <cstdint>
+
+namespace Time
+{
+  /// @brief Core clock cycles per millisecond.
+  constexpr uint32_t CyclesPerMillisecond = Peripherals::Rcc::ResetAndClockControl::Ticks;
+
+  /// @brief Converts a duration to core clock cycles, rounding up.
+  /// @tparam ClockCyclesPerMillisecond Core clock cycles per millisecond.
+  /// @param duration Duration to convert.
+  /// @return Number of cycles lasting at least the duration.
+  template<uint32_t ClockCyclesPerMillisecond, class Rep, class Period>
+  constexpr uint32_t ToCycles(const std::chrono::duration<Rep, Period> duration)
+  {
+    const auto nanoseconds = std::chrono::ceil<std::chrono::nanoseconds>(duration).count();
+    const auto cycles = ((static_cast<uint64_t>(nanoseconds) * ClockCyclesPerMillisecond) + 999'999U) / 1'000'000U;
+
+    return static_cast<uint32_t>(cycles);
+  }
+
+  /// @brief Converts nanoseconds to core clock cycles of the configured clock, rounding up.
+  /// @param nanoseconds Duration in nanoseconds.
+  /// @return Number of cycles lasting at least the duration.
+  constexpr uint32_t NanosecondsToCycles(const uint32_t nanoseconds)
+  {
+    return ToCycles<CyclesPerMillisecond>(std::chrono::nanoseconds(nanoseconds));
+  }
+
+  /// @brief Converts microseconds to core clock cycles of the configured clock.
+  /// @param microseconds Duration in microseconds.
+  /// @return Number of cycles lasting the duration.
+  constexpr uint32_t MicrosecondsToCycles(const uint32_t microseconds)
+  {
+    return ToCycles<CyclesPerMillisecond>(std::chrono::microseconds(microseconds));
+  }
+
+  /// @brief Busy waits for a number of core clock cycles.
+  /// @param cycles Number of cycles to wait, at most about 59 s at 72 MHz.
+  /// @details The cycle counter has to be running, which the RCC ensures after configuring the clocks. The call
+  ///          overhead of a few cycles is included in the delay. Returns immediately on the host.
+  inline void DelayCycles(const uint32_t cycles)
+  {
+#if defined(__arm__)
+    const auto start = Peripherals::Dwt::CycleCounter::Now();
+
+    while ((Peripherals::Dwt::CycleCounter::Now() - start) < cycles)
+    {
+    }
+#else
+    static_cast<void>(cycles);
+#endif
+  }
+
+  /// @brief Busy waits for a number of microseconds.
+  /// @param microseconds Number of microseconds to wait.
+  inline void DelayMicroseconds(const uint32_t microseconds)
+  {
+    DelayCycles(MicrosecondsToCycles(microseconds));
+  }
+
+  /// @brief Busy waits for a constant number of nanoseconds.
+  /// @tparam Nanoseconds Number of nanoseconds to wait, the conversion to cycles happens at compile time.
+  template<uint32_t Nanoseconds>
+  inline void DelayNanoseconds()
+  {
+    constexpr auto cycles = NanosecondsToCycles(Nanoseconds);
+    DelayCycles(cycles);
+  }
+}  // namespace Time
+
+#endif  // TIME_DELAY_HPP
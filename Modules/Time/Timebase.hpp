@@ -0,0 +1,178 @@
+/// @file Timebase.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Wrap free 64 bit timebase built from the millisecond tick counter and the SysTick current value.
+/// @details The tick counter is split into two 32 bit halves, since the core cannot read 64 bit values atomically.
+///          A timestamp combines the counter with the cycles already counted in the tick in progress. The hardware is
+///          accessed through a template parameter, so the races between the timer reload and the tick interrupt can
+///          be tested on the host.
+
+#ifndef TIME_TIMEBASE_HPP
+#define TIME_TIMEBASE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+namespace Time
+{
+  /// @brief Tick counter which does not wrap around, written by a single interrupt handler.
+  class TickCounter
+  {
+   private:
+    /// @brief Lower half of the counter.
+    volatile uint32_t low = 0;
+
+    /// @brief Upper half of the counter, incremented whenever the lower half wraps around.
+    volatile uint32_t high = 0;
+
+   public:
+    /// @brief Constructor for the TickCounter class.
+    constexpr TickCounter() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    TickCounter(const TickCounter&) = delete;
+    TickCounter& operator=(const TickCounter&) = delete;
+    TickCounter(TickCounter&&) = delete;
+    TickCounter& operator=(TickCounter&&) = delete;
+    ~TickCounter() = default;
+
+    /// @brief Advances the counter.
+    /// @param ticks Number of elapsed ticks.
+    /// @details Must only be called by the tick interrupt or with interrupts disabled.
+    void Advance(const uint32_t ticks)
+    {
+      const auto previous = low;
+      low = previous + ticks;
+
+      if (low < previous)
+      {
+        high = high + 1;
+      }
+    }
+
+    /// @brief Returns the lower half of the counter.
+    /// @return Ticks modulo 2^32.
+    uint32_t GetLow() const
+    {
+      return low;
+    }
+
+    /// @brief Returns the full counter.
+    /// @return Ticks since start.
+    /// @details The upper half is read before and after the lower one, a carry in between leads to a retry.
+    uint64_t Get() const
+    {
+      for (;;)
+      {
+        const auto upper = high;
+        const auto lower = low;
+
+        if (upper == high)
+        {
+          return (static_cast<uint64_t>(upper) << 32U) | lower;
+        }
+      }
+    }
+  };
+
+  /// @brief Combines a tick count with the current value of a down counting tick timer.
+  /// @tparam CyclesPerTick Timer cycles per tick.
+  /// @param ticks Tick counter value.
+  /// @param value Current value of the timer, it reaches zero at the tick boundary and reloads with the next cycle.
+  /// @param reloadPending True if the tick interrupt was pending after the value was read.
+  /// @return Cycles since the start of the tick counter.
+  /// @details A pending interrupt means the counter lags one tick behind the timer. If the value was read after the
+  ///          boundary, only a few cycles of the new tick have elapsed and the missing tick is added. If it was read
+  ///          before the boundary, the value still belongs to the counted tick. The two cases are told apart by
+  ///          the value, which is valid as long as reading it and the pending flag takes less than half a tick.
+  template<uint32_t CyclesPerTick>
+  constexpr uint64_t ComposeCycles(uint64_t ticks, const uint32_t value, const bool reloadPending)
+  {
+    const auto elapsed = (value == 0 || value > CyclesPerTick) ? uint32_t {0} : CyclesPerTick - value;
+
+    if (reloadPending && elapsed < CyclesPerTick / 2)
+    {
+      ++ticks;
+    }
+
+    return (ticks * CyclesPerTick) + elapsed;
+  }
+
+  /// @brief Converts the current value of a down counting tick timer to a timer with another number of cycles per tick.
+  /// @param value Current value of the timer.
+  /// @param fromCyclesPerTick Cycles per tick the value was counted with.
+  /// @param toCyclesPerTick Cycles per tick of the new timer.
+  /// @return Value the new timer has to start with to end the tick in progress at the same time, at least 1.
+  /// @details Used when the clock of the timer changes, so the tick boundaries do not shift. A value of zero means
+  ///          the tick boundary has just passed and a full tick remains.
+  constexpr uint32_t ConvertTickValue(const uint32_t value, const uint32_t fromCyclesPerTick,
+    const uint32_t toCyclesPerTick)
+  {
+    if (value == 0 || value >= fromCyclesPerTick)
+    {
+      return toCyclesPerTick;
+    }
+
+    const auto converted =
+      ((static_cast<uint64_t>(value) * toCyclesPerTick) + (fromCyclesPerTick / 2)) / fromCyclesPerTick;
+
+    return converted == 0 ? 1 : static_cast<uint32_t>(converted);
+  }
+
+  /// @brief Reads a timestamp without racing against the tick interrupt.
+  /// @tparam CyclesPerTick Timer cycles per tick.
+  /// @tparam TickTimer Type providing the timer by the static methods `GetValue()` and `IsReloadPending()`.
+  /// @param counter Tick counter advanced by the tick interrupt.
+  /// @return Cycles since the start of the tick counter.
+  /// @details If the interrupt advanced the counter while the timer was read, the read is repeated. If the interrupt
+  ///          could not run, because interrupts are masked or a handler with a higher priority is active, the pending
+  ///          flag accounts for the tick.
+  template<uint32_t CyclesPerTick, class TickTimer>
+  uint64_t ReadCycles(const TickCounter& counter)
+  {
+    for (;;)
+    {
+      const auto ticks = counter.Get();
+      const auto value = TickTimer::GetValue();
+      const auto reloadPending = TickTimer::IsReloadPending();
+
+      if (counter.GetLow() == static_cast<uint32_t>(ticks))
+      {
+        return ComposeCycles<CyclesPerTick>(ticks, value, reloadPending);
+      }
+    }
+  }
+
+  /// @brief Clock satisfying the standard `TrivialClock` requirements, counting in timer cycles.
+  /// @tparam Source Type providing the cycles since start by a static `Now()` method.
+  /// @tparam Frequency Cycles per second.
+  template<class Source, uint32_t Frequency>
+  struct CycleClock
+  {
+    /// @brief Arithmetic type of the durations.
+    using rep = int64_t;  // NOLINT(readability-identifier-naming)
+
+    /// @brief Length of one cycle in seconds.
+    using period = std::ratio<1, Frequency>;  // NOLINT(readability-identifier-naming)
+
+    /// @brief Duration in cycles.
+    using duration = std::chrono::duration<rep, period>;  // NOLINT(readability-identifier-naming)
+
+    /// @brief Point in time of this clock.
+    using time_point = std::chrono::time_point<CycleClock>;  // NOLINT(readability-identifier-naming)
+
+    /// @brief The clock never goes back and does not wrap around.
+    static constexpr bool is_steady = true;  // NOLINT(readability-identifier-naming)
+
+    /// @brief Returns the current time.
+    /// @return Time since start.
+    static time_point now() noexcept  // NOLINT(readability-identifier-naming)
+    {
+      return time_point(duration(static_cast<rep>(Source::Now())));
+    }
+  };
+}  // namespace Time
+
+#endif  // TIME_TIMEBASE_HPP
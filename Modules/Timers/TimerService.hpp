@@ -0,0 +1,113 @@
+/// @file TimerService.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Software timers driven by the SysTick interrupt.
+/// @details The SysTick handler advances the timer wheel. Threads start and stop timers and run the deferred
+///          callbacks, each access of a thread is a short critical section that masks the SysTick and the
+///          interrupts below it.
+
+#ifndef TIMERS_TIMERSERVICE_HPP
+#define TIMERS_TIMERSERVICE_HPP
+
+#include <CriticalSection.hpp>
+#include <TimerWheel.hpp>
+#include <cstdint>
+
+namespace Timers
+{
+  /// @brief Type of the timer wheel, 4 levels of 32 slots cover about 17 minutes at 1 ms per tick.
+  using TimerWheelType = TimerWheel<5, 4>;
+
+  /// @brief Software timers driven by the SysTick interrupt.
+  class TimerService
+  {
+   private:
+    /// @brief Timer wheel holding the active timers.
+    TimerWheelType wheel;
+
+    /// @brief Takes the next timer whose callback was deferred to thread context.
+    /// @return Timer, nullptr if none is deferred.
+    const Timer* TakeDeferred()
+    {
+      const Peripherals::KernelLock lock;
+      return wheel.TakeDeferred();
+    }
+
+   public:
+    /// @brief Constructor for the TimerService class.
+    constexpr TimerService() = default;
+
+    // Deleted copy and move constructors and assignment operators.
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+    TimerService(TimerService&&) = delete;
+    TimerService& operator=(TimerService&&) = delete;
+    ~TimerService() = default;
+
+    /// @brief Starts or restarts a timer.
+    /// @param timer Timer to start.
+    /// @param delay Ticks until the first expiry.
+    /// @param period Ticks between the following expiries, 0 for a one shot timer.
+    void Start(Timer& timer, const uint32_t delay, const uint32_t period = 0)
+    {
+      const Peripherals::KernelLock lock;
+      wheel.Start(timer, delay, period);
+    }
+
+    /// @brief Stops a timer.
+    /// @param timer Timer to stop.
+    void Stop(Timer& timer)
+    {
+      const Peripherals::KernelLock lock;
+      wheel.Stop(timer);
+    }
+
+    /// @brief Processes all ticks up to the given one, called by the SysTick handler.
+    /// @param tick Current tick.
+    void OnTick(const uint32_t tick)
+    {
+      wheel.Advance(tick);
+    }
+
+    /// @brief Runs the callbacks deferred to thread context.
+    void RunDeferred()
+    {
+      for (;;)
+      {
+        const auto* timer = TakeDeferred();
+
+        if (timer == nullptr)
+        {
+          return;
+        }
+
+        TimerWheelType::RunCallback(*timer);
+      }
+    }
+
+    /// @brief Returns whether a callback waits for `RunDeferred()`.
+    /// @return True if a callback is deferred.
+    /// @details Called by the idle path with interrupts masked, so an expiry cannot slip in before the sleep.
+    bool HasDeferred()
+    {
+      const Peripherals::KernelLock lock;
+      return wheel.HasDeferred();
+    }
+
+    /// @brief Returns the earliest tick at which a timer may expire.
+    /// @param fallback Tick returned if no timer is active.
+    /// @return Earliest tick, or the fallback if it is earlier.
+    uint32_t GetNextExpiry(const uint32_t fallback)
+    {
+      const Peripherals::KernelLock lock;
+      return wheel.GetNextExpiry(fallback);
+    }
+  };
+
+  /// @brief Timer service used by the tasks and the SysTick handler.
+  /// @details Constant initialized, so the SysTick handler can use it before any constructor ran.
+  inline constinit TimerService timerService {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace Timers
+
+#endif  // TIMERS_TIMERSERVICE_HPP
@@ -0,0 +1,478 @@
+/// @file TimerWheel.hpp
+/// @author Dennis Stumm
+/// @date 2025
+/// @version 1.0
+/// @brief Hierarchical timer wheel for software timers.
+/// @details The wheel consists of several levels of slots. The first level has one slot per tick, every following
+///          level covers the whole range of the previous one per slot. A timer is placed in the slot of its expiry on
+///          the lowest level covering its delay and moved down a level whenever the previous level wrapped around.
+///          Starting, stopping and expiring a timer therefore never scans the other timers.
+
+#ifndef TIMERS_TIMERWHEEL_HPP
+#define TIMERS_TIMERWHEEL_HPP
+
+#include <Scheduler.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Timers
+{
+  /// @brief Context in which the callback of a timer runs.
+  enum class CallbackContext : uint8_t
+  {
+    /// @brief The callback runs directly in the tick interrupt, it has to be short.
+    Interrupt = 0,
+
+    /// @brief The callback is deferred until the thread runs the deferred callbacks.
+    Thread = 1,
+  };
+
+  template<std::size_t SlotBits, std::size_t Levels>
+  class TimerWheel;
+
+  /// @brief Software timer, which is linked into a timer wheel while it is active.
+  class Timer
+  {
+   private:
+    template<std::size_t SlotBits, std::size_t Levels>
+    friend class TimerWheel;
+
+    /// @brief Next timer in the same slot.
+    Timer* next = nullptr;
+
+    /// @brief Pointer pointing to this timer, null if the timer is not active.
+    Timer** link = nullptr;
+
+    /// @brief Next timer in the list of deferred callbacks.
+    Timer* nextDeferred = nullptr;
+
+    /// @brief Function called when the timer expires.
+    void (*callback)(void* context);
+
+    /// @brief Context passed to the callback.
+    void* context;
+
+    /// @brief Tick at which the timer expires.
+    uint32_t expiry = 0;
+
+    /// @brief Period of the timer in ticks, 0 for a one shot timer.
+    uint32_t period = 0;
+
+    /// @brief Number of expiries which occurred while the deferred callback was still pending.
+    uint32_t overruns = 0;
+
+    /// @brief Context in which the callback runs.
+    CallbackContext callbackContext;
+
+    /// @brief Level of the slot the timer is linked into.
+    uint8_t level = 0;
+
+    /// @brief Slot the timer is linked into.
+    uint8_t slot = 0;
+
+    /// @brief Whether the timer is in the list of deferred callbacks.
+    bool deferred = false;
+
+   public:
+    /// @brief Constructor for the Timer class.
+    /// @param callback Function called when the timer expires.
+    /// @param context Context passed to the callback.
+    /// @param callbackContext Context in which the callback runs.
+    constexpr Timer(void (*callback)(void*),
+      void* context,
+      const CallbackContext callbackContext = CallbackContext::Interrupt)
+      : callback(callback), context(context), callbackContext(callbackContext)
+    {
+    }
+
+    // Deleted copy and move constructors and assignment operators, the wheel links the timer by its address.
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    Timer& operator=(Timer&&) = delete;
+    ~Timer() = default;
+
+    /// @brief Returns whether the timer is running.
+    /// @return True if the timer is linked into a wheel.
+    bool IsActive() const
+    {
+      return link != nullptr;
+    }
+
+    /// @brief Returns the tick at which the timer expires next.
+    /// @return Expiry tick, only valid while the timer is active.
+    uint32_t GetExpiry() const
+    {
+      return expiry;
+    }
+
+    /// @brief Returns the number of expiries whose deferred callback was merged with a pending one.
+    /// @return Number of overruns.
+    uint32_t GetOverruns() const
+    {
+      return overruns;
+    }
+  };
+
+  /// @brief Hierarchical timer wheel.
+  /// @tparam SlotBits Number of bits of the tick resolved per level, at most 5.
+  /// @tparam Levels Number of levels.
+  /// @details The wheel is not synchronized, the owner has to prevent the tick interrupt from running while a thread
+  ///          modifies it.
+  template<std::size_t SlotBits = 5, std::size_t Levels = 4>
+  class TimerWheel
+  {
+   private:
+    static_assert(SlotBits > 0 && SlotBits <= 5, "The slot occupancy is tracked in a single word");
+    static_assert(Levels > 0 && SlotBits * Levels < 32, "The wheel has to cover less than the tick range");
+
+    /// @brief Number of slots per level.
+    static constexpr std::size_t Slots = std::size_t {1} << SlotBits;
+
+    /// @brief Mask of a slot index.
+    static constexpr uint32_t SlotMask = Slots - 1;
+
+    /// @brief Mask of all slots of a level.
+    static constexpr uint32_t AllSlots = Slots == 32 ? ~uint32_t {0} : (uint32_t {1} << Slots) - 1;
+
+    /// @brief Level used for timers which are currently expired or cascaded.
+    static constexpr uint8_t DetachedLevel = Levels;
+
+    /// @brief Slots of all levels, each one is the head of a list of timers.
+    std::array<std::array<Timer*, Slots>, Levels> slots {};
+
+    /// @brief Bit mask of the non empty slots per level.
+    std::array<uint32_t, Levels> occupied {};
+
+    /// @brief Next tick to process.
+    uint32_t nextTick = 1;
+
+    /// @brief First timer whose callback is deferred to thread context.
+    Timer* deferredHead = nullptr;
+
+    /// @brief Last timer whose callback is deferred to thread context.
+    Timer* deferredTail = nullptr;
+
+    /// @brief Returns the shift of the tick for a level.
+    /// @param level Level of the wheel.
+    /// @return Number of bits resolved by the lower levels.
+    static constexpr uint32_t Shift(const std::size_t level)
+    {
+      return static_cast<uint32_t>(SlotBits * level);
+    }
+
+    /// @brief Rotates the slot occupancy of a level, so the given slot becomes the first one.
+    /// @param mask Slot occupancy.
+    /// @param slot Slot which becomes the first one.
+    /// @return Rotated slot occupancy.
+    static constexpr uint32_t RotateSlots(const uint32_t mask, const uint32_t slot)
+    {
+      return slot == 0 ? mask : ((mask >> slot) | (mask << (Slots - slot))) & AllSlots;
+    }
+
+    /// @brief Links a timer into the slot of its expiry.
+    /// @param timer Timer to link.
+    void Insert(Timer& timer)
+    {
+      const auto base = nextTick;
+      const auto delay = timer.expiry - base;
+      auto position = timer.expiry;
+      std::size_t level = 0;
+
+      if (static_cast<int32_t>(delay) < 0)
+      {
+        // Already expired, fire with the next tick
+        position = base;
+      }
+      else
+      {
+        while (level + 1 < Levels && delay >= (uint32_t {1} << Shift(level + 1)))
+        {
+          ++level;
+        }
+
+        // Timers beyond the range of the wheel wait in the last slot and are placed again once cascaded
+        if (level + 1 == Levels && delay >= (uint32_t {1} << Shift(Levels)))
+        {
+          position = base + (uint32_t {1} << Shift(Levels)) - 1;
+        }
+      }
+
+      const auto slot = (position >> Shift(level)) & SlotMask;
+      auto& head = slots[level][slot];
+
+      timer.next = head;
+      timer.link = &head;
+      timer.level = static_cast<uint8_t>(level);
+      timer.slot = static_cast<uint8_t>(slot);
+
+      if (head != nullptr)
+      {
+        head->link = &timer.next;
+      }
+
+      head = &timer;
+      occupied[level] |= uint32_t {1} << slot;
+    }
+
+    /// @brief Removes a timer from its list.
+    /// @param timer Timer to remove.
+    void Unlink(Timer& timer)
+    {
+      *timer.link = timer.next;
+
+      if (timer.next != nullptr)
+      {
+        timer.next->link = timer.link;
+      }
+
+      if (timer.level != DetachedLevel && slots[timer.level][timer.slot] == nullptr)
+      {
+        occupied[timer.level] &= ~(uint32_t {1} << timer.slot);
+      }
+
+      timer.next = nullptr;
+      timer.link = nullptr;
+    }
+
+    /// @brief Takes all timers of a slot into a separate list.
+    /// @param level Level of the slot.
+    /// @param slot Index of the slot.
+    /// @param list Head of the separate list.
+    /// @details The timers of the list can still be stopped by callbacks while the list is processed.
+    void Detach(const std::size_t level, const std::size_t slot, Timer*& list)
+    {
+      list = slots[level][slot];
+      slots[level][slot] = nullptr;
+      occupied[level] &= ~(uint32_t {1} << slot);
+
+      for (auto* timer = list; timer != nullptr; timer = timer->next)
+      {
+        timer->level = DetachedLevel;
+      }
+
+      if (list != nullptr)
+      {
+        list->link = &list;
+      }
+    }
+
+    /// @brief Moves the timers of a slot to the lower levels.
+    /// @param level Level of the slot.
+    /// @param tick Processed tick.
+    /// @return Index of the cascaded slot.
+    std::size_t Cascade(const std::size_t level, const uint32_t tick)
+    {
+      const auto slot = (tick >> Shift(level)) & SlotMask;
+      Timer* list = nullptr;
+      Detach(level, slot, list);
+
+      while (list != nullptr)
+      {
+        auto& timer = *list;
+        Unlink(timer);
+        Insert(timer);
+      }
+
+      return slot;
+    }
+
+    /// @brief Runs the callbacks of all timers in the slot of a tick.
+    /// @param tick Processed tick.
+    void Expire(const uint32_t tick)
+    {
+      Timer* list = nullptr;
+      Detach(0, tick & SlotMask, list);
+
+      while (list != nullptr)
+      {
+        auto& timer = *list;
+        Unlink(timer);
+
+        // Periodic timers are placed again before the callback, so the period does not drift
+        if (timer.period != 0)
+        {
+          timer.expiry += timer.period;
+          Insert(timer);
+        }
+
+        if (timer.callbackContext == CallbackContext::Interrupt)
+        {
+          timer.callback(timer.context);
+        }
+        else
+        {
+          Defer(timer);
+        }
+      }
+    }
+
+    /// @brief Appends a timer to the list of deferred callbacks.
+    /// @param timer Timer whose callback is deferred.
+    void Defer(Timer& timer)
+    {
+      if (timer.deferred)
+      {
+        ++timer.overruns;
+        return;
+      }
+
+      timer.deferred = true;
+      timer.nextDeferred = nullptr;
+
+      if (deferredTail == nullptr)
+      {
+        deferredHead = &timer;
+      }
+      else
+      {
+        deferredTail->nextDeferred = &timer;
+      }
+
+      deferredTail = &timer;
+    }
+
+   public:
+    /// @brief Maximum delay in ticks, which is handled without placing the timer again.
+    static constexpr uint32_t Range = uint32_t {1} << Shift(Levels);
+
+    /// @brief Constructor for the TimerWheel class.
+    /// @param now Current tick.
+    explicit constexpr TimerWheel(const uint32_t now = 0) : nextTick(now + 1)
+    {
+    }
+
+    // Deleted copy and move constructors and assignment operators.
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+    ~TimerWheel() = default;
+
+    /// @brief Starts or restarts a timer.
+    /// @param timer Timer to start.
+    /// @param delay Ticks until the first expiry, at least one.
+    /// @param period Ticks between the following expiries, 0 for a one shot timer.
+    void Start(Timer& timer, const uint32_t delay, const uint32_t period = 0)
+    {
+      Stop(timer);
+
+      timer.expiry = GetNow() + (delay == 0 ? 1 : delay);
+      timer.period = period;
+      Insert(timer);
+    }
+
+    /// @brief Stops a timer, a pending deferred callback still runs.
+    /// @param timer Timer to stop.
+    void Stop(Timer& timer)
+    {
+      if (timer.IsActive())
+      {
+        Unlink(timer);
+      }
+    }
+
+    /// @brief Processes all ticks up to the given one.
+    /// @param tick Current tick.
+    /// @details Ticks skipped by the tickless idle are processed one after another, every tick costs the same
+    ///          regardless of the number of active timers.
+    void Advance(const uint32_t tick)
+    {
+      while (Scheduler::IsDue(tick, nextTick))
+      {
+        const auto current = nextTick;
+
+        // Every time a level wrapped around, the current slot of the next level is moved down
+        for (std::size_t level = 1; level < Levels; ++level)
+        {
+          if (((current >> Shift(level - 1)) & SlotMask) != 0 || Cascade(level, current) != 0)
+          {
+            break;
+          }
+        }
+
+        // Callbacks restarting a timer already refer to the following tick
+        ++nextTick;
+        Expire(current);
+      }
+    }
+
+    /// @brief Returns the earliest tick at which the wheel has work to do.
+    /// @param fallback Tick returned if no timer is active.
+    /// @return Expiry of the next timer on the first level or the next cascade of a higher level, if earlier than the
+    ///         fallback.
+    uint32_t GetNextExpiry(const uint32_t fallback) const
+    {
+      auto next = fallback;
+
+      for (std::size_t level = 0; level < Levels; ++level)
+      {
+        if (occupied[level] == 0)
+        {
+          continue;
+        }
+
+        // The current slot of a higher level was already cascaded, unless the next tick starts its range
+        const auto current = (nextTick >> Shift(level)) & SlotMask;
+        const auto cascaded = level != 0 && (nextTick & ((uint32_t {1} << Shift(level)) - 1)) != 0;
+        const auto rotated = RotateSlots(occupied[level], current) & (cascaded ? ~uint32_t {1} : ~uint32_t {0});
+        const auto distance = rotated == 0 ? static_cast<uint32_t>(Slots) : std::countr_zero(rotated);
+        const auto candidate = ((nextTick >> Shift(level)) + distance) << Shift(level);
+
+        if (Scheduler::IsDue(next, candidate))
+        {
+          next = candidate;
+        }
+      }
+
+      return next;
+    }
+
+    /// @brief Takes the next timer whose callback is deferred to thread context.
+    /// @return Timer whose callback has to run next, null if there is none.
+    /// @details Returns one timer at a time, so the owner only has to lock the wheel while taking it.
+    Timer* TakeDeferred()
+    {
+      auto* timer = deferredHead;
+
+      if (timer != nullptr)
+      {
+        deferredHead = timer->nextDeferred;
+
+        if (deferredHead == nullptr)
+        {
+          deferredTail = nullptr;
+        }
+
+        timer->deferred = false;
+      }
+
+      return timer;
+    }
+
+    /// @brief Returns whether a callback is deferred to thread context.
+    /// @return True if `TakeDeferred` would return a timer.
+    bool HasDeferred() const
+    {
+      return deferredHead != nullptr;
+    }
+
+    /// @brief Runs the callback of a timer.
+    /// @param timer Timer returned by `TakeDeferred`.
+    static void RunCallback(const Timer& timer)
+    {
+      timer.callback(timer.context);
+    }
+
+    /// @brief Returns the last processed tick.
+    /// @return Current tick of the wheel.
+    uint32_t GetNow() const
+    {
+      return nextTick - 1;
+    }
+  };
+}  // namespace Timers
+
+#endif  // TIMERS_TIMERWHEEL_HPP
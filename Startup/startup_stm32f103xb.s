@@ -62,33 +62,55 @@ Reset_Handler:
 
 /* Call the clock system initialization function.*/
     bl  SystemInit
+/* Start the boot profiling and the oscillators, neither .data nor .bss are valid yet.*/
+    bl  BootStart
 
-/* Copy the data segment initializers from flash to SRAM */
+/* Copy the data segment initializers from flash to SRAM, four words per iteration */
   ldr r0, =_sdata
   ldr r1, =_edata
   ldr r2, =_sidata
-  movs r3, #0
+  subs r4, r1, #16
+  b LoopCopyDataBlock
+
+CopyDataBlock:
+  ldmia r2!, {r3, r5, r6, r7}
+  stmia r0!, {r3, r5, r6, r7}
+
+LoopCopyDataBlock:
+  cmp r0, r4
+  bls CopyDataBlock
   b LoopCopyDataInit
 
+/* Copy the remaining words */
 CopyDataInit:
-  ldr r4, [r2, r3]
-  str r4, [r0, r3]
-  adds r3, r3, #4
+  ldr r3, [r2], #4
+  str r3, [r0], #4
 
 LoopCopyDataInit:
-  adds r4, r0, r3
-  cmp r4, r1
+  cmp r0, r1
   bcc CopyDataInit
-  
-/* Zero fill the bss segment. */
+
+/* Zero fill the bss segment, four words per iteration. */
   ldr r2, =_sbss
   ldr r4, =_ebss
   movs r3, #0
+  movs r5, #0
+  movs r6, #0
+  movs r7, #0
+  subs r1, r4, #16
+  b LoopFillZerobssBlock
+
+FillZerobssBlock:
+  stmia r2!, {r3, r5, r6, r7}
+
+LoopFillZerobssBlock:
+  cmp r2, r1
+  bls FillZerobssBlock
   b LoopFillZerobss
 
+/* Zero the remaining words */
 FillZerobss:
-  str  r3, [r2]
-  adds r2, r2, #4
+  str r3, [r2], #4
 
 LoopFillZerobss:
   cmp r2, r4
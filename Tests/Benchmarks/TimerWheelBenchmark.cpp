@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <TimerWheel.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using WheelType = Timers::TimerWheel<5, 4>;
+
+  /// @brief Number of ticks measured per run.
+  constexpr uint32_t MeasuredTicks = 60000;
+
+  /// @brief Number of periodic timers expiring during the measurement.
+  constexpr auto PeriodicTimers = 8;
+
+  /// @brief Measures the mean cost of a tick with the given number of additional pending timers.
+  /// @param pendingTimers Number of timers which are active but do not expire during the measurement.
+  /// @return Best mean duration of a tick out of several runs in nanoseconds.
+  double MeasureTick(const std::size_t pendingTimers)
+  {
+    auto best = std::chrono::nanoseconds::max();
+
+    for (auto run = 0; run < 5; ++run)
+    {
+      WheelType wheel;
+      uint32_t expiries = 0;
+      std::vector<std::unique_ptr<Timers::Timer>> timers;
+      std::mt19937 random(1);
+
+      // Pending timers expire after the measurement, their slots are not touched in between
+      std::uniform_int_distribution<uint32_t> delays(2 * WheelType::Range / 8, 3 * WheelType::Range / 8);
+
+      for (std::size_t i = 0; i < pendingTimers; ++i)
+      {
+        timers.push_back(std::make_unique<Timers::Timer>([](void* context) { ++*static_cast<uint32_t*>(context); },
+          &expiries));
+        wheel.Start(*timers.back(), delays(random));
+      }
+
+      for (auto i = 0; i < PeriodicTimers; ++i)
+      {
+        timers.push_back(std::make_unique<Timers::Timer>([](void* context) { ++*static_cast<uint32_t*>(context); },
+          &expiries));
+        wheel.Start(*timers.back(), 1, static_cast<uint32_t>(10 + i));
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+
+      for (uint32_t tick = 1; tick <= MeasuredTicks; ++tick)
+      {
+        wheel.Advance(tick);
+      }
+
+      best = std::min(best, std::chrono::steady_clock::now() - start);
+      EXPECT_GT(expiries, MeasuredTicks / 20);
+    }
+
+    return static_cast<double>(best.count()) / MeasuredTicks;
+  }
+}  // namespace
+
+TEST(TimerWheelBenchmark, TickCostDoesNotGrowWithTheNumberOfTimers)
+{
+  std::vector<double> costs;
+
+  for (const std::size_t pendingTimers : {16U, 128U, 1024U, 8192U})
+  {
+    costs.push_back(MeasureTick(pendingTimers));
+    std::cout << "[ BENCHMARK] " << pendingTimers << " pending timers: " << costs.back() << " ns per tick\n";
+  }
+
+  // A scanning implementation would be about 500 times slower with 8192 timers than with 16
+  EXPECT_LT(costs.back(), 3.0 * costs.front());
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <SpscQueue.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using QueueType = Events::SpscQueue<uint32_t, 8>;
+
+TEST(SpscQueue, PopsElementsInPushOrder)
+{
+  QueueType queue;
+
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_TRUE(queue.Push(1));
+  EXPECT_TRUE(queue.Push(2));
+  EXPECT_TRUE(queue.Push(3));
+  EXPECT_EQ(queue.Size(), 3U);
+
+  EXPECT_EQ(queue.Pop(), 1U);
+  EXPECT_EQ(queue.Pop(), 2U);
+  EXPECT_EQ(queue.Pop(), 3U);
+  EXPECT_FALSE(queue.Pop().has_value());
+}
+
+TEST(SpscQueue, RejectsAndCountsElementsWhenFull)
+{
+  QueueType queue;
+
+  for (uint32_t i = 0; i < 8; ++i)
+  {
+    EXPECT_TRUE(queue.Push(i));
+  }
+
+  EXPECT_FALSE(queue.Push(8));
+  EXPECT_FALSE(queue.Push(9));
+  EXPECT_EQ(queue.GetDropped(), 2U);
+  EXPECT_EQ(queue.Size(), 8U);
+
+  EXPECT_EQ(queue.Pop(), 0U);
+  EXPECT_TRUE(queue.Push(10));
+}
+
+TEST(SpscQueue, WrapsAroundTheBuffer)
+{
+  QueueType queue;
+
+  for (uint32_t i = 0; i < 100; ++i)
+  {
+    EXPECT_TRUE(queue.Push(i));
+    EXPECT_TRUE(queue.Push(i + 1000));
+    EXPECT_EQ(queue.Pop(), i);
+    EXPECT_EQ(queue.Pop(), i + 1000);
+  }
+
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(SpscQueue, TransfersEveryElementBetweenTwoThreads)
+{
+  constexpr uint32_t count = 1000000;
+  QueueType queue;
+  uint32_t received = 0;
+  uint64_t sum = 0;
+  bool ordered = true;
+
+  std::thread consumer([&]() {
+    uint32_t expected = 0;
+
+    while (received < count)
+    {
+      if (const auto element = queue.Pop())
+      {
+        ordered = ordered && (*element == expected);
+        sum += *element;
+        ++expected;
+        ++received;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::thread producer([&]() {
+    for (uint32_t i = 0; i < count;)
+    {
+      if (queue.Push(i))
+      {
+        ++i;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  producer.join();
+  consumer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(received, count);
+  EXPECT_EQ(sum, uint64_t {count} * (count - 1) / 2);
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(SpscQueue, CountsDropsOfAProducerThatNeverWaits)
+{
+  constexpr uint32_t count = 200000;
+  QueueType queue;
+  uint32_t received = 0;
+  bool ordered = true;
+  std::atomic<bool> producing {true};
+
+  std::thread consumer([&]() {
+    int64_t last = -1;
+
+    while (producing.load() || !queue.Empty())
+    {
+      if (const auto element = queue.Pop())
+      {
+        ordered = ordered && (static_cast<int64_t>(*element) > last);
+        last = *element;
+        ++received;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::thread producer([&]() {
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      queue.Push(i);
+    }
+
+    producing.store(false);
+  });
+
+  producer.join();
+  consumer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(received + queue.GetDropped(), count);
+}
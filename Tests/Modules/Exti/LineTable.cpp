@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <Exti.hpp>
+#include <cstdint>
+#include <vector>
+
+using Peripherals::Exti::LineBinding;
+using Peripherals::Exti::LineHandler;
+using Peripherals::Exti::LineTable;
+
+namespace
+{
+  /// @brief Pending register of the simulated EXTI, writing a one clears the bit.
+  struct PendingRegister
+  {
+    uint32_t value = 0;
+    uint32_t writes = 0;
+
+    operator uint32_t() const
+    {
+      return value;
+    }
+
+    PendingRegister& operator=(const uint32_t cleared)
+    {
+      ++writes;
+      value &= ~cleared;
+      return *this;
+    }
+  };
+
+  /// @brief Simulated EXTI with the register names of `EXTI_TypeDef`.
+  struct SimulatedExti
+  {
+    uint32_t IMR = 0xFFFFU;
+    uint32_t EMR = 0;
+    uint32_t RTSR = 0;
+    uint32_t FTSR = 0;
+    uint32_t SWIER = 0;
+    PendingRegister PR;
+  };
+
+  /// @brief Lines in the order their handlers were called.
+  std::vector<uint32_t> calls;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+  void Record([[maybe_unused]] void* context, const uint32_t line)
+  {
+    calls.push_back(line);
+  }
+
+  void Count(void* context, [[maybe_unused]] const uint32_t line)
+  {
+    ++*static_cast<uint32_t*>(context);
+  }
+
+  /// @brief Table of the switches and the push button, built at compile time.
+  constexpr auto InputsTable = LineTable {
+    LineBinding {0, LineHandler {Record, nullptr}},
+    LineBinding {8, LineHandler {Record, nullptr}},
+    LineBinding {15, LineHandler {Record, nullptr}},
+  };
+
+  static_assert(InputsTable.IsAttached(0) && InputsTable.IsAttached(8) && InputsTable.IsAttached(15));
+  static_assert(!InputsTable.IsAttached(5) && !InputsTable.IsAttached(10));
+  static_assert(Peripherals::Exti::Lines9To5 == (EXTI_PR_PR5 | EXTI_PR_PR6 | EXTI_PR_PR7 | EXTI_PR_PR8 | EXTI_PR_PR9));
+  static_assert(Peripherals::Exti::Lines15To10 ==
+                (EXTI_PR_PR10 | EXTI_PR_PR11 | EXTI_PR_PR12 | EXTI_PR_PR13 | EXTI_PR_PR14 | EXTI_PR_PR15));
+}  // namespace
+
+class LineTableTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    calls.clear();
+  }
+};
+
+TEST_F(LineTableTest, CallsTheHandlersOfThePendingLinesOfTheInterrupt)
+{
+  SimulatedExti exti;
+  exti.PR.value = 0x8101U;
+
+  EXPECT_EQ(InputsTable.Dispatch(exti, Peripherals::Exti::Lines15To10), 0x8000U);
+  EXPECT_EQ(calls, (std::vector<uint32_t> {15}));
+
+  EXPECT_EQ(InputsTable.Dispatch(exti, Peripherals::Exti::Lines9To5), 0x0100U);
+  EXPECT_EQ(calls, (std::vector<uint32_t> {15, 8}));
+
+  // The lines of the other interrupts stay pending
+  EXPECT_EQ(exti.PR.value, 0x0001U);
+}
+
+TEST_F(LineTableTest, ClearsAllPendingLinesWithOneWriteBeforeTheHandlersRun)
+{
+  SimulatedExti exti;
+  exti.PR.value = Peripherals::Exti::Lines9To5;
+
+  // Lines without handler are cleared as well, or their interrupt would fire again right away
+  InputsTable.Dispatch(exti, Peripherals::Exti::Lines9To5);
+
+  EXPECT_EQ(exti.PR.value, 0U);
+  EXPECT_EQ(exti.PR.writes, 1U);
+  EXPECT_EQ(calls, (std::vector<uint32_t> {8}));
+}
+
+TEST_F(LineTableTest, DispatchesFromTheHighestPendingLine)
+{
+  SimulatedExti exti;
+  LineTable table;
+
+  for (uint32_t line = 10; line < Peripherals::Exti::LineCount; ++line)
+  {
+    table.Attach(line, Record, nullptr);
+  }
+
+  exti.PR.value = 0xA400U;
+  table.Dispatch(exti, Peripherals::Exti::Lines15To10);
+
+  EXPECT_EQ(calls, (std::vector<uint32_t> {15, 13, 10}));
+}
+
+TEST_F(LineTableTest, IgnoresMaskedLines)
+{
+  SimulatedExti exti;
+  exti.IMR = 0x0100U;
+  exti.PR.value = 0x0300U;
+
+  EXPECT_EQ(InputsTable.Dispatch(exti, Peripherals::Exti::Lines9To5), 0x0100U);
+  EXPECT_EQ(exti.PR.value, 0x0200U);
+}
+
+TEST_F(LineTableTest, PassesTheContextAndReplacesHandlersAtRuntime)
+{
+  SimulatedExti exti;
+  auto table = InputsTable;
+  uint32_t count = 0;
+
+  table.Attach(8, Count, &count);
+  table.Detach(15);
+
+  exti.PR.value = 0x8100U;
+  table.Dispatch(exti, Peripherals::Exti::Lines9To5);
+  table.Dispatch(exti, Peripherals::Exti::Lines15To10);
+
+  EXPECT_EQ(count, 1U);
+  EXPECT_TRUE(calls.empty());
+  EXPECT_EQ(exti.PR.value, 0U);
+}
+
+TEST_F(LineTableTest, CallsEachHandlerOncePerPendingLine)
+{
+  SimulatedExti exti;
+  LineTable table;
+  uint32_t count = 0;
+
+  for (uint32_t line = 0; line < Peripherals::Exti::LineCount; ++line)
+  {
+    table.Attach(line, Count, &count);
+  }
+
+  // Registering more handlers does not add iterations, only pending lines do
+  exti.PR.value = 0x0020U;
+  table.Dispatch(exti, Peripherals::Exti::Lines9To5);
+  EXPECT_EQ(count, 1U);
+}
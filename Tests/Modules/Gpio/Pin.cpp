@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <stm32f1xx.h>
+#include <sys/mman.h>
+
+#include <Gpio.hpp>
+#include <Pin.hpp>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+using Peripherals::Gpio::InputOutputType;
+using Peripherals::Gpio::Mode;
+
+namespace
+{
+  using OutputPin = Peripherals::Gpio::Pin<GPIOB_BASE, 10>;
+  using InputPin = Peripherals::Gpio::Pin<GPIOB_BASE, 3>;
+
+  /// @brief Start of the simulated peripheral region, from the AFIO up to the RCC.
+  constexpr uintptr_t RegionStart = AFIO_BASE;
+
+  /// @brief Size of the simulated peripheral region in bytes.
+  constexpr std::size_t RegionSize = (RCC_BASE + 0x1000) - AFIO_BASE;
+
+  /// @brief Pins whose address is a template parameter have no storage.
+  struct TwoPins
+  {
+    [[no_unique_address]] OutputPin output;
+    [[no_unique_address]] InputPin input;
+  };
+
+  static_assert(std::is_empty_v<OutputPin> && std::is_empty_v<TwoPins>);
+}  // namespace
+
+/// @brief Pins driving simulated registers mapped at the addresses of the peripherals.
+/// @details The simulation does not model the hardware behavior of the registers, so the tests check the values
+///          stored by the driver, e.g. the bit set/reset register keeps the last written value.
+class Pin : public ::testing::Test
+{
+ protected:
+  static inline void* region = MAP_FAILED;
+
+  static void SetUpTestSuite()
+  {
+    region = mmap(reinterpret_cast<void*>(RegionStart),
+      RegionSize,
+      PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+      -1,
+      0);
+  }
+
+  static void TearDownTestSuite()
+  {
+    if (region != MAP_FAILED)
+    {
+      munmap(region, RegionSize);
+      region = MAP_FAILED;
+    }
+  }
+
+  void SetUp() override
+  {
+    if (region != reinterpret_cast<void*>(RegionStart))
+    {
+      GTEST_SKIP() << "The peripheral addresses cannot be mapped on this host";
+    }
+
+    std::memset(region, 0, RegionSize);
+  }
+};
+
+TEST_F(Pin, ConfiguresLikeTheRuntimeGpio)
+{
+  GPIOB->CRH = 0xFFFFFFFFU;
+  const OutputPin output(Mode::OutputLow, InputOutputType::AnalogMode_PushPull);
+  const auto pinConfiguration = GPIOB->CRH;
+
+  GPIOB->CRH = 0xFFFFFFFFU;
+  const Peripherals::Gpio::Gpio gpio(GPIOB, 10, Mode::OutputLow, InputOutputType::AnalogMode_PushPull);
+
+  EXPECT_EQ(pinConfiguration, 0xFFFFF2FFU);
+  EXPECT_EQ(GPIOB->CRH, pinConfiguration);
+  EXPECT_NE(RCC->APB2ENR & RCC_APB2ENR_IOPBEN, 0U);
+}
+
+TEST_F(Pin, AppliesTheAfioConfiguration)
+{
+  const InputPin input(Mode::Input,
+    InputOutputType::Floating_OpenDrain,
+    {
+      .afioMask = AFIO_MAPR_SWJ_CFG_Msk,
+      .afioMode = AFIO_MAPR_SWJ_CFG_JTAGDISABLE,
+    });
+
+  EXPECT_EQ(GPIOB->CRL, 0x00004000U);
+  EXPECT_EQ(AFIO->MAPR, AFIO_MAPR_SWJ_CFG_JTAGDISABLE);
+  EXPECT_NE(RCC->APB2ENR & RCC_APB2ENR_AFIOEN, 0U);
+}
+
+TEST_F(Pin, WritesOnlyTheBitSetResetRegisters)
+{
+  GPIOB->ODR = 0x1234U;
+
+  OutputPin::Set();
+  EXPECT_EQ(GPIOB->BSRR, 1U << 10U);
+
+  OutputPin::Clear();
+  EXPECT_EQ(GPIOB->BRR, 1U << 10U);
+
+  OutputPin::SetState(false);
+  EXPECT_EQ(GPIOB->BSRR, 1U << 26U);
+
+  OutputPin::SetState(true);
+  EXPECT_EQ(GPIOB->BSRR, 1U << 10U);
+
+  // The output data register is left to the hardware, other pins are never written
+  EXPECT_EQ(GPIOB->ODR, 0x1234U);
+}
+
+TEST_F(Pin, TogglesFromTheOutputDataRegister)
+{
+  OutputPin::ToggleState();
+  EXPECT_EQ(GPIOB->BSRR, 1U << 10U);
+
+  GPIOB->ODR = 1U << 10U;
+  OutputPin::ToggleState();
+  EXPECT_EQ(GPIOB->BSRR, 1U << 26U);
+}
+
+TEST_F(Pin, ReadsTheInputDataRegister)
+{
+  EXPECT_FALSE(InputPin::GetState());
+
+  GPIOB->IDR = 1U << 3U;
+  EXPECT_TRUE(InputPin::GetState());
+  EXPECT_FALSE(OutputPin::GetState());
+}
+
+TEST_F(Pin, RuntimeGpioUsesTheBitSetResetRegister)
+{
+  const Peripherals::Gpio::Gpio gpio(GPIOB, 10, Mode::OutputLow, InputOutputType::AnalogMode_PushPull);
+  GPIOB->ODR = 0x1234U;
+
+  gpio.SetState(false);
+  EXPECT_EQ(GPIOB->BSRR, 1U << 26U);
+
+  gpio.SetState(true);
+  EXPECT_EQ(GPIOB->BSRR, 1U << 10U);
+  EXPECT_EQ(GPIOB->ODR, 0x1234U);
+}
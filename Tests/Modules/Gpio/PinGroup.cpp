@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <PinGroup.hpp>
+#include <cstdint>
+
+using Peripherals::Gpio::InputOutputType;
+using Peripherals::Gpio::Mode;
+using Peripherals::Gpio::PinConfig;
+using Peripherals::Gpio::PortConfiguration;
+
+namespace
+{
+  /// @brief Register of the simulated GPIO block, counting the reads and writes.
+  struct CountingRegister
+  {
+    uint32_t value = 0;
+    uint32_t reads = 0;
+    uint32_t writes = 0;
+
+    operator uint32_t()
+    {
+      ++reads;
+      return value;
+    }
+
+    CountingRegister& operator=(const uint32_t newValue)
+    {
+      ++writes;
+      value = newValue;
+      return *this;
+    }
+  };
+
+  /// @brief Simulated GPIO block with the register names of `GPIO_TypeDef`.
+  struct CountingPort
+  {
+    CountingRegister CRL;
+    CountingRegister CRH;
+    CountingRegister IDR;
+    CountingRegister ODR;
+    CountingRegister BSRR;
+    CountingRegister BRR;
+    CountingRegister LCKR;
+
+    uint32_t GetAccesses() const
+    {
+      uint32_t accesses = 0;
+
+      for (const auto* const reg : {&CRL, &CRH, &IDR, &ODR, &BSRR, &BRR, &LCKR})
+      {
+        accesses += reg->reads + reg->writes;
+      }
+
+      return accesses;
+    }
+  };
+
+  /// @brief Configuration of the LEDs task, two outputs and two inputs spread over both configuration registers.
+  constexpr auto LedsConfiguration = PortConfiguration {
+    PinConfig {3, Mode::Input, InputOutputType::Floating_OpenDrain},
+    PinConfig {8, Mode::Input, InputOutputType::Floating_OpenDrain},
+    PinConfig {13, Mode::OutputLow, InputOutputType::AnalogMode_PushPull},
+    PinConfig {14, Mode::OutputLow, InputOutputType::AnalogMode_PushPull},
+  };
+
+  static_assert(Peripherals::Gpio::PinGroup<GPIOB_BASE, 13, 14>::Mask == 0x6000U);
+  static_assert(Peripherals::Gpio::GetClockEnableMask(GPIOA_BASE) == RCC_APB2ENR_IOPAEN);
+  static_assert(Peripherals::Gpio::GetClockEnableMask(GPIOE_BASE) == RCC_APB2ENR_IOPEEN);
+  static_assert(Peripherals::Gpio::GetClockEnableMask(AFIO_BASE) == 0);
+}  // namespace
+
+TEST(PortConfiguration, MergesTheFieldsOfThePins)
+{
+  static_assert(LedsConfiguration.GetLowMask() == 0x0000F000U);
+  static_assert(LedsConfiguration.GetLowValue() == 0x00004000U);
+  static_assert(LedsConfiguration.GetHighMask() == 0x0FF0000FU);
+  static_assert(LedsConfiguration.GetHighValue() == 0x02200004U);
+
+  // A pin given twice takes the last configuration
+  constexpr auto reconfigured = PortConfiguration {LedsConfiguration}.Add(
+    PinConfig {13, Mode::OutputHigh, InputOutputType::Floating_OpenDrain});
+  static_assert(reconfigured.GetHighMask() == LedsConfiguration.GetHighMask());
+  static_assert(reconfigured.GetHighValue() == 0x02700004U);
+}
+
+TEST(PortWriter, ConfiguresAllPinsWithOneWritePerRegister)
+{
+  CountingPort port;
+  port.CRL.value = 0x44444444U;
+  port.CRH.value = 0x44444444U;
+
+  Peripherals::Gpio::PortWriter<CountingPort>(&port).Configure(LedsConfiguration);
+
+  EXPECT_EQ(port.CRL.value, 0x44444444U);
+  EXPECT_EQ(port.CRH.value, 0x42244444U);
+  EXPECT_EQ(port.CRL.writes + port.CRH.writes, 2U);
+  EXPECT_EQ(port.GetAccesses(), 4U);
+}
+
+TEST(PortWriter, LeavesARegisterWithoutConfiguredPinsUntouched)
+{
+  CountingPort port;
+
+  Peripherals::Gpio::PortWriter<CountingPort>(&port).Configure(
+    PortConfiguration {PinConfig {13, Mode::OutputLow, InputOutputType::AnalogMode_PushPull}});
+
+  EXPECT_EQ(port.CRL.reads + port.CRL.writes, 0U);
+  EXPECT_EQ(port.GetAccesses(), 2U);
+}
+
+TEST(PortWriter, NeedsFewerAccessesThanConfiguringPinByPin)
+{
+  CountingPort merged;
+  CountingPort single;
+  const Peripherals::Gpio::PortWriter<CountingPort> singleWriter(&single);
+
+  Peripherals::Gpio::PortWriter<CountingPort>(&merged).Configure(LedsConfiguration);
+
+  for (const auto& pin : {PinConfig {3, Mode::Input, InputOutputType::Floating_OpenDrain},
+         PinConfig {8, Mode::Input, InputOutputType::Floating_OpenDrain},
+         PinConfig {13, Mode::OutputLow, InputOutputType::AnalogMode_PushPull},
+         PinConfig {14, Mode::OutputLow, InputOutputType::AnalogMode_PushPull}})
+  {
+    singleWriter.Configure(PortConfiguration {pin});
+  }
+
+  EXPECT_EQ(merged.CRL.value, single.CRL.value);
+  EXPECT_EQ(merged.CRH.value, single.CRH.value);
+  EXPECT_EQ(single.GetAccesses(), 8U);
+  EXPECT_EQ(merged.GetAccesses(), 4U);
+}
+
+TEST(PortWriter, WritesAnyMaskWithOneStore)
+{
+  CountingPort port;
+  const Peripherals::Gpio::PortWriter<CountingPort> writer(&port);
+
+  writer.Set(0x6000U);
+  EXPECT_EQ(port.BSRR.value, 0x00006000U);
+
+  writer.Clear(0x6000U);
+  EXPECT_EQ(port.BRR.value, 0x6000U);
+
+  writer.Write(0x6000U, 0x2001U);
+  EXPECT_EQ(port.BSRR.value, 0x40002000U);
+
+  EXPECT_EQ(port.GetAccesses(), 3U);
+}
+
+TEST(PortWriter, ReadsAnyMaskWithOneLoad)
+{
+  CountingPort port;
+  port.IDR.value = 0x8101U;
+
+  EXPECT_EQ(Peripherals::Gpio::PortWriter<CountingPort>(&port).Read(0x8100U), 0x8100U);
+  EXPECT_EQ(port.GetAccesses(), 1U);
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <Debouncer.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  using DebouncerType = Input::Debouncer<GPIOA_BASE, GPIOB_BASE>;
+
+  /// @brief Push button press sampled every 5 ms, the contact bounces for about 15 ms before it closes.
+  constexpr std::string_view ButtonPress = "000001011010111111111111";
+
+  /// @brief Push button release, the contact bounces for about 10 ms before it opens.
+  constexpr std::string_view ButtonRelease = "111110101000000000000000";
+
+  /// @brief Switch picking up a short spike, e.g. from a neighboring line, without being moved.
+  constexpr std::string_view SwitchSpike = "000000111000011100000000";
+
+  /// @brief Edge seen while replaying a trace.
+  struct Edge
+  {
+    std::size_t sample;
+    bool pressed;
+
+    bool operator==(const Edge&) const = default;
+  };
+
+  /// @brief Replays traces of two pins of port A through the debouncer.
+  /// @param debouncer Debouncer to replay the traces through.
+  /// @param first Trace of pin 0.
+  /// @param second Trace of pin 8.
+  /// @return Edges of pin 0 and of pin 8, in the order they were seen.
+  std::pair<std::vector<Edge>, std::vector<Edge>> Replay(DebouncerType& debouncer,
+    const std::string_view first,
+    const std::string_view second)
+  {
+    std::pair<std::vector<Edge>, std::vector<Edge>> edges;
+
+    for (std::size_t sample = 0; sample < first.size(); ++sample)
+    {
+      const auto levels = static_cast<uint16_t>((first[sample] == '1' ? 0x0001U : 0U) |
+                                                (second[sample] == '1' ? 0x0100U : 0U));
+      debouncer.Update(0, levels);
+
+      for (const auto& [mask, pinEdges] : {std::pair {uint16_t {0x0001U}, &edges.first},
+             std::pair {uint16_t {0x0100U}, &edges.second}})
+      {
+        if (debouncer.TakePressed<GPIOA_BASE>(mask) != 0)
+        {
+          pinEdges->push_back({sample, true});
+        }
+
+        if (debouncer.TakeReleased<GPIOA_BASE>(mask) != 0)
+        {
+          pinEdges->push_back({sample, false});
+        }
+      }
+    }
+
+    return edges;
+  }
+}  // namespace
+
+TEST(VerticalCounter, ChangesAfterTheStableSamples)
+{
+  Input::VerticalCounter counter;
+
+  for (uint32_t sample = 1; sample < Input::VerticalCounter::StableSamples; ++sample)
+  {
+    EXPECT_EQ(counter.Update(0xFFFFU), 0U);
+  }
+
+  EXPECT_EQ(counter.Update(0xFFFFU), 0xFFFFU);
+  EXPECT_EQ(counter.GetState(), 0xFFFFU);
+  EXPECT_EQ(counter.Update(0xFFFFU), 0U);
+}
+
+TEST(VerticalCounter, RestartsCountingOnABounce)
+{
+  Input::VerticalCounter counter;
+
+  counter.Update(0x0001U);
+  counter.Update(0x0001U);
+  counter.Update(0x0001U);
+  counter.Update(0x0000U);
+
+  EXPECT_EQ(counter.Update(0x0001U), 0U);
+  EXPECT_EQ(counter.Update(0x0001U), 0U);
+  EXPECT_EQ(counter.Update(0x0001U), 0U);
+  EXPECT_EQ(counter.Update(0x0001U), 0x0001U);
+}
+
+TEST(Debouncer, ReportsOnePressPerBouncingPress)
+{
+  DebouncerType debouncer;
+  const auto [button, unused] = Replay(debouncer, ButtonPress, "000000000000000000000000");
+
+  // Stable from sample 12 on, the fourth equal sample is 15
+  EXPECT_EQ(button, (std::vector<Edge> {{15, true}}));
+  EXPECT_TRUE(unused.empty());
+  EXPECT_EQ(debouncer.GetState<GPIOA_BASE>(), 0x0001U);
+}
+
+TEST(Debouncer, ReportsOneReleasePerBouncingRelease)
+{
+  DebouncerType debouncer;
+  debouncer.Update(0, 0x0001U);
+  debouncer.Update(0, 0x0001U);
+  debouncer.Update(0, 0x0001U);
+  debouncer.Update(0, 0x0001U);
+  debouncer.TakePressed<GPIOA_BASE>(0xFFFFU);
+
+  const auto [button, unused] = Replay(debouncer, ButtonRelease, "000000000000000000000000");
+
+  EXPECT_EQ(button, (std::vector<Edge> {{12, false}}));
+  EXPECT_EQ(debouncer.GetState<GPIOA_BASE>(), 0x0000U);
+}
+
+TEST(Debouncer, IgnoresSpikesShorterThanTheStableSamples)
+{
+  DebouncerType debouncer;
+  const auto [spike, unused] = Replay(debouncer, SwitchSpike, "000000000000000000000000");
+
+  EXPECT_TRUE(spike.empty());
+  EXPECT_EQ(debouncer.GetState<GPIOA_BASE>(), 0x0000U);
+}
+
+TEST(Debouncer, DebouncesThePinsOfAPortIndependently)
+{
+  DebouncerType debouncer;
+  const auto [button, spike] = Replay(debouncer, ButtonPress, SwitchSpike);
+
+  EXPECT_EQ(button, (std::vector<Edge> {{15, true}}));
+  EXPECT_TRUE(spike.empty());
+}
+
+TEST(Debouncer, KeepsTheEdgesUntilTheyAreTaken)
+{
+  DebouncerType debouncer;
+
+  for (uint32_t sample = 0; sample < Input::VerticalCounter::StableSamples; ++sample)
+  {
+    debouncer.Update(1, 0x0C00U);
+  }
+
+  // The ports are debounced separately and taking one pin leaves the edge of the other
+  EXPECT_EQ(debouncer.TakePressed<GPIOA_BASE>(0xFFFFU), 0U);
+  EXPECT_EQ(debouncer.TakePressed<GPIOB_BASE>(0x0400U), 0x0400U);
+  EXPECT_EQ(debouncer.TakePressed<GPIOB_BASE>(0x0400U), 0U);
+  EXPECT_EQ(debouncer.TakePressed<GPIOB_BASE>(0xFFFFU), 0x0800U);
+  EXPECT_EQ(debouncer.TakeReleased<GPIOB_BASE>(0xFFFFU), 0U);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <InputWatch.hpp>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <vector>
+
+namespace
+{
+  using WatchType = Input::InputWatch<3, GPIOA_BASE, GPIOB_BASE>;
+
+  /// @brief Longest time from the last level change of a pin until its subscribers are notified, in ticks.
+  constexpr uint32_t DebounceTicks = Input::VerticalCounter::StableSamples * WatchType::SamplePeriod;
+
+  /// @brief Level change of a pin at a tick.
+  struct Change
+  {
+    uint32_t tick;
+    uint8_t port;
+    uint16_t pin;
+    bool level;
+  };
+
+  /// @brief Notification received by a subscriber.
+  struct Notification
+  {
+    uint32_t tick;
+    uint16_t changed;
+  };
+
+  /// @brief Subscriber recording its notifications with the virtual time.
+  struct Subscriber
+  {
+    const uint32_t* now;
+    std::vector<Notification> notifications;
+
+    static void OnChange(void* context, const uint16_t changed)
+    {
+      auto& subscriber = *static_cast<Subscriber*>(context);
+      subscriber.notifications.push_back({*subscriber.now, changed});
+    }
+  };
+
+  /// @brief Runs the watch in virtual time, with 1 ms ticks, the edge interrupts and the sample timer.
+  class Simulation
+  {
+   public:
+    WatchType watch;
+    uint32_t now = 0;
+    uint32_t samples = 0;
+    std::array<uint16_t, 2> levels {};
+    std::optional<uint32_t> nextSample;
+
+    /// @brief Advances the virtual time, applying the level changes and sampling like the inputs task.
+    /// @param changes Level changes, ordered by their tick.
+    /// @param until Tick to stop at.
+    void Run(const std::vector<Change>& changes, const uint32_t until)
+    {
+      auto change = changes.begin();
+
+      for (; now < until; ++now)
+      {
+        // Every level change of a pin is an edge of its EXTI line
+        for (; change != changes.end() && change->tick == now; ++change)
+        {
+          const auto mask = static_cast<uint16_t>(1U << change->pin);
+          levels[change->port] = change->level ? (levels[change->port] | mask) : (levels[change->port] & ~mask);
+
+          if (watch.OnEdge())
+          {
+            nextSample = now + WatchType::SamplePeriod;
+          }
+        }
+
+        if (nextSample == now)
+        {
+          ++samples;
+          nextSample = watch.Update(levels) ? std::optional(now + WatchType::SamplePeriod) : std::nullopt;
+        }
+      }
+    }
+  };
+
+  /// @brief Contact of a push button on pin 0 of port A closing at a tick and bouncing for about 8 ms.
+  /// @param tick Tick of the first contact.
+  /// @return Level changes, the last one at `tick + 8`.
+  std::vector<Change> BouncingPress(const uint32_t tick)
+  {
+    std::vector<Change> changes;
+    auto level = true;
+
+    for (const auto offset : {0U, 1U, 3U, 4U, 8U})
+    {
+      changes.push_back({tick + offset, 0, 0, level});
+      level = !level;
+    }
+
+    return changes;
+  }
+}  // namespace
+
+TEST(InputWatch, NotifiesWithinTheDebounceTimeAfterTheLastBounce)
+{
+  Simulation simulation;
+  Subscriber button {&simulation.now, {}};
+  ASSERT_TRUE(simulation.watch.Subscribe<GPIOA_BASE>(0x0001U, Subscriber::OnChange, &button));
+
+  simulation.Run(BouncingPress(100), 200);
+
+  ASSERT_EQ(button.notifications.size(), 1U);
+  EXPECT_EQ(button.notifications[0].changed, 0x0001U);
+  EXPECT_GT(button.notifications[0].tick, 108U);
+  EXPECT_LE(button.notifications[0].tick - 108U, DebounceTicks);
+  EXPECT_EQ(simulation.watch.GetDebouncer().GetState<GPIOA_BASE>(), 0x0001U);
+}
+
+TEST(InputWatch, ReactsToACleanEdgeAfterTheStableSamples)
+{
+  Simulation simulation;
+  Subscriber button {&simulation.now, {}};
+  simulation.watch.Subscribe<GPIOA_BASE>(0x0001U, Subscriber::OnChange, &button);
+
+  simulation.Run({{50, 0, 0, true}}, 100);
+
+  // The first sample is one period after the edge, the level is confirmed by the last of the stable samples
+  ASSERT_EQ(button.notifications.size(), 1U);
+  EXPECT_EQ(button.notifications[0].tick - 50U, DebounceTicks);
+}
+
+TEST(InputWatch, DoesNotSampleWhileThePinsRest)
+{
+  Simulation simulation;
+  Subscriber button {&simulation.now, {}};
+  simulation.watch.Subscribe<GPIOA_BASE>(0x0001U, Subscriber::OnChange, &button);
+
+  simulation.Run({}, 1000);
+  EXPECT_EQ(simulation.samples, 0U);
+
+  // A sample finding the contact open again stops the sampling, the sample confirming the press stops it for good
+  simulation.Run(BouncingPress(1000), 2000);
+  EXPECT_FALSE(simulation.watch.IsSampling());
+  EXPECT_FALSE(simulation.nextSample.has_value());
+  EXPECT_LE(simulation.samples, (8U + DebounceTicks) / WatchType::SamplePeriod + 1U);
+  EXPECT_EQ(button.notifications.size(), 1U);
+}
+
+TEST(InputWatch, IgnoresSpikesAndStopsSampling)
+{
+  Simulation simulation;
+  Subscriber button {&simulation.now, {}};
+  simulation.watch.Subscribe<GPIOA_BASE>(0x0001U, Subscriber::OnChange, &button);
+
+  simulation.Run({{10, 0, 0, true}, {12, 0, 0, false}}, 500);
+
+  EXPECT_TRUE(button.notifications.empty());
+  EXPECT_FALSE(simulation.watch.IsSampling());
+  EXPECT_EQ(simulation.samples, 1U);
+}
+
+TEST(InputWatch, NotifiesOnlyTheSubscribersOfTheChangedPins)
+{
+  Simulation simulation;
+  Subscriber switches {&simulation.now, {}};
+  Subscriber button {&simulation.now, {}};
+  Subscriber portB {&simulation.now, {}};
+  simulation.watch.Subscribe<GPIOA_BASE>(0x8100U, Subscriber::OnChange, &switches);
+  simulation.watch.Subscribe<GPIOA_BASE>(0x0001U, Subscriber::OnChange, &button);
+  simulation.watch.Subscribe<GPIOB_BASE>(0x8100U, Subscriber::OnChange, &portB);
+
+  // A switch opening and closing again, then both switches moving together
+  simulation.Run({{10, 0, 8, true}, {100, 0, 8, false}, {200, 0, 8, true}, {200, 0, 15, true}}, 300);
+
+  ASSERT_EQ(switches.notifications.size(), 3U);
+  EXPECT_EQ(switches.notifications[0].changed, 0x0100U);
+  EXPECT_EQ(switches.notifications[1].changed, 0x0100U);
+  EXPECT_EQ(switches.notifications[2].changed, 0x8100U);
+  EXPECT_TRUE(button.notifications.empty());
+  EXPECT_TRUE(portB.notifications.empty());
+}
+
+TEST(InputWatch, RefusesSubscriptionsBeyondItsCapacity)
+{
+  WatchType watch;
+  Subscriber subscriber {nullptr, {}};
+
+  EXPECT_TRUE(watch.Subscribe<GPIOA_BASE>(0x0001U, Subscriber::OnChange, &subscriber));
+  EXPECT_TRUE(watch.Subscribe<GPIOA_BASE>(0x0002U, Subscriber::OnChange, &subscriber));
+  EXPECT_TRUE(watch.Subscribe<GPIOB_BASE>(0x0001U, Subscriber::OnChange, &subscriber));
+  EXPECT_FALSE(watch.Subscribe<GPIOB_BASE>(0x0002U, Subscriber::OnChange, &subscriber));
+}
+
+TEST(InputWatch, RestartsTheSamplingOnlyOncePerChange)
+{
+  WatchType watch;
+
+  EXPECT_TRUE(watch.OnEdge());
+  EXPECT_FALSE(watch.OnEdge());
+  EXPECT_TRUE(watch.IsSampling());
+
+  EXPECT_FALSE(watch.Update({}));
+  EXPECT_FALSE(watch.IsSampling());
+  EXPECT_TRUE(watch.OnEdge());
+}
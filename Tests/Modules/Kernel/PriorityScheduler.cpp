@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <PriorityScheduler.hpp>
+#include <ThreadStack.hpp>
+#include <cstdint>
+
+namespace
+{
+  using SchedulerType = Kernel::PriorityScheduler<4>;
+
+  constexpr std::size_t EventThread = 0;
+  constexpr std::size_t DisplayThread = 2;
+  constexpr std::size_t IdleThread = 3;
+}  // namespace
+
+TEST(PriorityScheduler, SelectsTheReadyThreadWithTheHighestPriority)
+{
+  SchedulerType scheduler;
+  EXPECT_EQ(scheduler.Select(), SchedulerType::NoThread);
+
+  scheduler.MakeReady(IdleThread);
+  scheduler.MakeReady(DisplayThread);
+  EXPECT_EQ(scheduler.Select(), DisplayThread);
+
+  scheduler.MakeReady(EventThread);
+  EXPECT_EQ(scheduler.Select(), EventThread);
+  EXPECT_TRUE(scheduler.IsPreemptionRequired(DisplayThread));
+
+  scheduler.Block(EventThread);
+  EXPECT_EQ(scheduler.Select(), DisplayThread);
+  EXPECT_FALSE(scheduler.IsPreemptionRequired(DisplayThread));
+}
+
+TEST(PriorityScheduler, SignalPreemptsLongRunningThread)
+{
+  SchedulerType scheduler;
+  Kernel::SignalState signal;
+  scheduler.MakeReady(EventThread);
+  scheduler.MakeReady(DisplayThread);
+  scheduler.MakeReady(IdleThread);
+
+  // The event thread waits, so the display refresh runs
+  EXPECT_TRUE(scheduler.Wait(EventThread, signal));
+  EXPECT_EQ(scheduler.Select(), DisplayThread);
+
+  // The interrupt handler sets the signal in the middle of the refresh
+  scheduler.Notify(signal);
+  EXPECT_TRUE(scheduler.IsPreemptionRequired(DisplayThread));
+  EXPECT_EQ(scheduler.Select(), EventThread);
+  EXPECT_EQ(signal.waiters, 0U);
+  EXPECT_FALSE(signal.pending);
+}
+
+TEST(PriorityScheduler, SignalWithoutWaiterIsLatched)
+{
+  SchedulerType scheduler;
+  Kernel::SignalState signal;
+  scheduler.MakeReady(EventThread);
+
+  scheduler.Notify(signal);
+  scheduler.Notify(signal);
+  EXPECT_TRUE(signal.pending);
+
+  // The latched signal is consumed once, the second wait blocks
+  EXPECT_FALSE(scheduler.Wait(EventThread, signal));
+  EXPECT_TRUE(scheduler.IsReady(EventThread));
+  EXPECT_TRUE(scheduler.Wait(EventThread, signal));
+  EXPECT_FALSE(scheduler.IsReady(EventThread));
+}
+
+TEST(PriorityScheduler, SignalWakesTheWaiterWithTheHighestPriority)
+{
+  SchedulerType scheduler;
+  Kernel::SignalState signal;
+
+  scheduler.Wait(DisplayThread, signal);
+  scheduler.Wait(EventThread, signal);
+
+  scheduler.Notify(signal);
+  EXPECT_TRUE(scheduler.IsReady(EventThread));
+  EXPECT_FALSE(scheduler.IsReady(DisplayThread));
+
+  scheduler.Notify(signal);
+  EXPECT_TRUE(scheduler.IsReady(DisplayThread));
+}
+
+TEST(PriorityScheduler, SleepingThreadsWakeAtTheirDeadline)
+{
+  SchedulerType scheduler;
+  scheduler.MakeReady(EventThread);
+  scheduler.MakeReady(DisplayThread);
+  scheduler.MakeReady(IdleThread);
+
+  scheduler.SleepUntil(EventThread, 10, 0);
+  scheduler.SleepUntil(DisplayThread, 5, 0);
+  EXPECT_EQ(scheduler.Select(), IdleThread);
+  EXPECT_EQ(scheduler.GetNextWakeup(100), 5U);
+  EXPECT_EQ(scheduler.GetNextWakeup(3), 3U);
+
+  scheduler.Tick(4);
+  EXPECT_EQ(scheduler.Select(), IdleThread);
+
+  scheduler.Tick(5);
+  EXPECT_EQ(scheduler.Select(), DisplayThread);
+  EXPECT_EQ(scheduler.GetNextWakeup(100), 10U);
+
+  // Ticks skipped by the tickless idle still wake the thread
+  scheduler.Tick(12);
+  EXPECT_EQ(scheduler.Select(), EventThread);
+  EXPECT_EQ(scheduler.GetNextWakeup(100), 100U);
+}
+
+TEST(PriorityScheduler, SleepUntilPassedDeadlineKeepsThreadReady)
+{
+  SchedulerType scheduler;
+  scheduler.MakeReady(DisplayThread);
+
+  scheduler.SleepUntil(DisplayThread, 10, 10);
+  EXPECT_TRUE(scheduler.IsReady(DisplayThread));
+
+  // Deadlines across the wrap around of the tick counter
+  scheduler.SleepUntil(DisplayThread, 5, UINT32_MAX - 5);
+  EXPECT_FALSE(scheduler.IsReady(DisplayThread));
+  scheduler.Tick(UINT32_MAX);
+  EXPECT_FALSE(scheduler.IsReady(DisplayThread));
+  scheduler.Tick(5);
+  EXPECT_TRUE(scheduler.IsReady(DisplayThread));
+}
+
+TEST(ThreadStack, BuildsTheInitialExceptionFrame)
+{
+  Kernel::ThreadStack<256> stack {};
+
+  const auto* stackPointer = Kernel::BuildInitialFrame(stack.words, 0x08000101, 0x20000010, 0x08000201);
+  const auto* top = stack.words.data() + stack.words.size();
+
+  ASSERT_EQ(top - stackPointer, 16);
+
+  // R0 holds the argument, LR the exit function, PC the entry without the Thumb bit and xPSR the Thumb state
+  EXPECT_EQ(stackPointer[8], 0x20000010U);
+  EXPECT_EQ(stackPointer[13], 0x08000201U);
+  EXPECT_EQ(stackPointer[14], 0x08000100U);
+  EXPECT_EQ(stackPointer[15], Kernel::InitialProgramStatus);
+
+  EXPECT_EQ(Kernel::GetUnusedWords(stack.words), stack.words.size() - 16);
+}
+
+TEST(ThreadStack, MeasuresTheUsedStack)
+{
+  Kernel::ThreadStack<256> stack {};
+  Kernel::BuildInitialFrame(stack.words, 0, 0, 0);
+
+  // Simulate a thread pushing 20 words below its initial frame
+  stack.words[stack.words.size() - 36] = 0;
+  EXPECT_EQ(Kernel::GetUnusedWords(stack.words), stack.words.size() - 36);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <DeferredLog.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  /// @brief Tick source of the tests, which may run a hook between claiming a slot and completing its record.
+  struct TestTickSource
+  {
+    static inline uint32_t now = 0;               // NOLINT
+    static inline std::function<void()> preempt;  // NOLINT
+
+    static uint32_t Now()
+    {
+      if (auto hook = std::exchange(preempt, nullptr))
+      {
+        hook();
+      }
+
+      return now;
+    }
+  };
+
+  using LogType = Logging::DeferredLog<4, TestTickSource>;
+
+  /// @brief Collects the written lines.
+  void Collect(void* context, const char* line, const std::size_t length)
+  {
+    static_cast<std::vector<std::string>*>(context)->emplace_back(line, length);
+  }
+
+  /// @brief Flushes a log and returns the written lines.
+  std::vector<std::string> Flush(LogType& log)
+  {
+    std::vector<std::string> lines;
+    log.Flush(Collect, &lines);
+    return lines;
+  }
+
+  enum class Source : uint8_t
+  {
+    Button = 7,
+  };
+}  // namespace
+
+class DeferredLogTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    TestTickSource::now = 0;
+    TestTickSource::preempt = nullptr;
+  }
+};
+
+TEST_F(DeferredLogTest, FormatsTheRecordsWhenFlushed)
+{
+  LogType log;
+
+  TestTickSource::now = 42;
+  EXPECT_TRUE(log.Write("Hello World!\n"));
+  TestTickSource::now = 1234;
+  EXPECT_TRUE(log.Write("line %lu from %lu, %lx\n", uint8_t {3}, Source::Button, 0xBEEFU));
+
+  EXPECT_EQ(Flush(log), (std::vector<std::string> {"      42 Hello World!\n", "    1234 line 3 from 7, beef\n"}));
+  EXPECT_TRUE(Flush(log).empty());
+}
+
+TEST_F(DeferredLogTest, DropsAndCountsRecordsWhileFull)
+{
+  LogType log;
+
+  for (uint32_t record = 0; record < 6; ++record)
+  {
+    EXPECT_EQ(log.Write("record %lu\n", record), record < 4);
+  }
+
+  EXPECT_EQ(log.GetDropped(), 2U);
+
+  const auto lines = Flush(log);
+  ASSERT_EQ(lines.size(), 5U);
+  EXPECT_EQ(lines[3], "       0 record 3\n");
+  EXPECT_EQ(lines[4], "2 log records dropped\n");
+
+  // The buffer is free again and the drops are reported once
+  EXPECT_TRUE(log.Write("record %lu\n", 6U));
+  EXPECT_EQ(Flush(log), (std::vector<std::string> {"       0 record 6\n"}));
+  EXPECT_EQ(log.GetDropped(), 2U);
+}
+
+TEST_F(DeferredLogTest, WrapsAroundTheBufferManyTimes)
+{
+  LogType log;
+
+  for (uint32_t record = 0; record < 100; ++record)
+  {
+    ASSERT_TRUE(log.Write("record %lu\n", record));
+    ASSERT_TRUE(log.Write("record %lu\n", record + 1000));
+    ASSERT_EQ(Flush(log).size(), 2U);
+  }
+
+  EXPECT_EQ(log.GetDropped(), 0U);
+}
+
+TEST_F(DeferredLogTest, APreemptedWriterHoldsBackOnlyTheRecordsBehindIt)
+{
+  LogType log;
+  Logging::Record record {};
+  auto poppedEarly = true;
+
+  // An interrupt preempts the first writer after it claimed its slot, the flushing thread cannot see either record
+  TestTickSource::preempt = [&] {
+    EXPECT_TRUE(log.Write("interrupt\n"));
+    poppedEarly = log.Pop(record);
+  };
+
+  EXPECT_TRUE(log.Write("thread\n"));
+
+  EXPECT_FALSE(poppedEarly);
+  EXPECT_EQ(Flush(log), (std::vector<std::string> {"       0 thread\n", "       0 interrupt\n"}));
+}
+
+TEST_F(DeferredLogTest, TruncatesLongLines)
+{
+  LogType log;
+  const std::string longFormat(2 * Logging::MaxLineLength, 'x');
+
+  log.Write(longFormat.c_str());
+
+  const auto lines = Flush(log);
+  ASSERT_EQ(lines.size(), 1U);
+  EXPECT_EQ(lines[0].size(), Logging::MaxLineLength - 1);
+}
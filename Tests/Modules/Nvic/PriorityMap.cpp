@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <CriticalSection.hpp>
+#include <InterruptManager.hpp>
+#include <NvicPriorities.hpp>
+#include <array>
+#include <cstdint>
+
+using Peripherals::InterruptManager;
+using Peripherals::Nvic::InterruptPriority;
+
+namespace Nvic = Peripherals::Nvic;
+
+namespace
+{
+  constexpr std::array<InterruptPriority, 3> ValidTable = {{
+    {IRQn_Type::TIM2_IRQn, 0, 0},
+    {IRQn_Type::SysTick_IRQn, 1, 0},
+    {IRQn_Type::USART1_IRQn, 2, 1},
+  }};
+
+  constexpr std::array<InterruptPriority, 2> DuplicateTable = {{
+    {IRQn_Type::USART1_IRQn, 2, 0},
+    {IRQn_Type::USART1_IRQn, 3, 0},
+  }};
+
+  constexpr std::array<InterruptPriority, 1> PreemptTooLarge = {{{IRQn_Type::TIM2_IRQn, Nvic::PreemptLevels, 0}}};
+
+  constexpr std::array<InterruptPriority, 1> SubTooLarge = {{{IRQn_Type::TIM2_IRQn, 0, Nvic::SubLevels}}};
+
+  static_assert(!Nvic::HasDuplicates(ValidTable) && Nvic::HasDuplicates(DuplicateTable));
+  static_assert(Nvic::IsWithinGroupLimits(ValidTable));
+  static_assert(!Nvic::IsWithinGroupLimits(PreemptTooLarge) && !Nvic::IsWithinGroupLimits(SubTooLarge));
+  static_assert(Nvic::GetPreempt(ValidTable, IRQn_Type::SysTick_IRQn) == 1);
+  static_assert(Nvic::GetPreempt(ValidTable, IRQn_Type::RTC_IRQn) == Nvic::PreemptLevels);
+  static_assert(Nvic::PreemptBits + Nvic::SubBits == __NVIC_PRIO_BITS);
+}  // namespace
+
+TEST(PriorityMapTest, EncodesLikeTheCmsisFunctionForTheGrouping)
+{
+  for (uint32_t preempt = 0; preempt < Nvic::PreemptLevels; ++preempt)
+  {
+    for (uint32_t sub = 0; sub < Nvic::SubLevels; ++sub)
+    {
+      const auto priority =
+        InterruptPriority {IRQn_Type::TIM2_IRQn, static_cast<uint8_t>(preempt), static_cast<uint8_t>(sub)};
+      EXPECT_EQ(Nvic::Encode(priority), NVIC_EncodePriority(Nvic::PriorityGrouping, preempt, sub));
+    }
+  }
+}
+
+TEST(PriorityMapTest, BasePriorityMasksTheLevelAndAllLowerPriorities)
+{
+  // The base priority masks all priorities numerically greater or equal, the sub priority bit is ignored
+  constexpr auto value = Peripherals::BasepriLock<2>::Value;
+  const auto lowestSub = Nvic::Encode(InterruptPriority {IRQn_Type::TIM2_IRQn, 2, 0}) << (8 - __NVIC_PRIO_BITS);
+  const auto higher = Nvic::Encode(InterruptPriority {IRQn_Type::TIM2_IRQn, 1, 1}) << (8 - __NVIC_PRIO_BITS);
+
+  EXPECT_EQ(value, 0x40U);
+  EXPECT_GE(lowestSub, value);
+  EXPECT_LT(higher, value);
+}
+
+TEST(PriorityMapTest, KeepsTheTimersAboveTheKernelAndPendSvLowest)
+{
+  const auto& priorities = InterruptManager::Priorities;
+
+  EXPECT_EQ(Nvic::GetPreempt(priorities, IRQn_Type::SysTick_IRQn), Peripherals::KernelPriority);
+  EXPECT_LT(Nvic::GetPreempt(priorities, IRQn_Type::TIM2_IRQn), Peripherals::KernelPriority);
+  EXPECT_LT(Nvic::GetPreempt(priorities, IRQn_Type::TIM3_IRQn), Peripherals::KernelPriority);
+  EXPECT_LT(Nvic::GetPreempt(priorities, IRQn_Type::TIM4_IRQn), Peripherals::KernelPriority);
+
+  // Every interrupt calling the kernel is masked by its critical sections
+  EXPECT_GE(Nvic::GetPreempt(priorities, IRQn_Type::EXTI0_IRQn), Peripherals::KernelPriority);
+  EXPECT_GE(Nvic::GetPreempt(priorities, IRQn_Type::USART1_IRQn), Peripherals::KernelPriority);
+  EXPECT_GE(Nvic::GetPreempt(priorities, IRQn_Type::RTC_IRQn), Peripherals::KernelPriority);
+
+  EXPECT_EQ(Nvic::GetPreempt(priorities, IRQn_Type::PendSV_IRQn), Nvic::PreemptLevels - 1);
+}
+
+TEST(PriorityMapTest, GuardsNestOnTheHost)
+{
+  // The registers do not exist on the host, the guards only have to compile and nest
+  const Peripherals::PrimaskLock outer;
+  const Peripherals::KernelLock inner;
+
+  EXPECT_EQ(Peripherals::Cpu::GetBasepri(), 0U);
+}
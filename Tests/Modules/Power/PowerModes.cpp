@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <PowerModes.hpp>
+#include <cstdint>
+
+using Power::PowerState;
+
+namespace
+{
+  constexpr uint32_t CyclesPerTick = 72000;
+
+  using PolicyType = Power::PowerPolicy<100, 10000>;
+}  // namespace
+
+TEST(PowerPolicy, SelectsTheDeepestStateWhichPaysOff)
+{
+  constexpr PolicyType policy;
+
+  static_assert(policy.Select(0) == PowerState::Run);
+  static_assert(policy.Select(1) == PowerState::Sleep);
+  static_assert(policy.Select(99) == PowerState::Sleep);
+  static_assert(policy.Select(100) == PowerState::Stop);
+  static_assert(policy.Select(9999) == PowerState::Stop);
+  static_assert(policy.Select(10000) == PowerState::Standby);
+}
+
+TEST(PowerPolicy, InhibitsAStateAndAllDeeperOnes)
+{
+  PolicyType policy;
+
+  policy.Inhibit(PowerState::Standby);
+  EXPECT_EQ(policy.Select(20000), PowerState::Stop);
+
+  policy.Inhibit(PowerState::Stop);
+  policy.Inhibit(PowerState::Stop);
+  EXPECT_EQ(policy.Select(20000), PowerState::Sleep);
+  EXPECT_FALSE(policy.IsAllowed(PowerState::Standby));
+
+  // The inhibits nest
+  policy.Release(PowerState::Stop);
+  EXPECT_EQ(policy.Select(20000), PowerState::Sleep);
+
+  policy.Release(PowerState::Stop);
+  EXPECT_EQ(policy.Select(20000), PowerState::Stop);
+
+  policy.Inhibit(PowerState::Sleep);
+  EXPECT_EQ(policy.Select(20000), PowerState::Run);
+  EXPECT_TRUE(policy.IsAllowed(PowerState::Run));
+}
+
+TEST(PowerResidency, ReportsTheFractionPerState)
+{
+  Power::PowerResidency<CyclesPerTick> residency;
+  EXPECT_EQ(residency.GetPermille(PowerState::Run), 0U);
+
+  residency.Record(PowerState::Run, CyclesPerTick * 100);
+  residency.Record(PowerState::Sleep, CyclesPerTick * 150);
+  residency.Record(PowerState::Run, CyclesPerTick * 50);
+  residency.Record(PowerState::Stop, uint64_t {CyclesPerTick} * 4700);
+
+  EXPECT_EQ(residency.GetMilliseconds(PowerState::Run), 150U);
+  EXPECT_EQ(residency.GetEntries(PowerState::Run), 2U);
+  EXPECT_EQ(residency.GetPermille(PowerState::Run), 30U);
+  EXPECT_EQ(residency.GetPermille(PowerState::Sleep), 30U);
+  EXPECT_EQ(residency.GetPermille(PowerState::Stop), 940U);
+  EXPECT_EQ(residency.GetPermille(PowerState::Standby), 0U);
+}
+
+TEST(RetainedState, RoundTripsThroughTheBackupRegisters)
+{
+  constexpr Power::RetainedState state {
+    .clockProfile = 1,
+    .standbyEntries = 513,
+    .standbyStart = 0x6789ABCDU,
+    .standbySeconds = 86400,
+  };
+
+  constexpr auto unpacked = Power::RetainedState::Unpack(state.Pack());
+  static_assert(unpacked.has_value());
+  static_assert(unpacked->clockProfile == 1 && unpacked->standbyEntries == 513);
+  static_assert(unpacked->standbyStart == 0x6789ABCDU && unpacked->standbySeconds == 86400);
+
+  // Registers cleared by a reset of the backup domain are not taken for a retained state
+  EXPECT_FALSE(Power::RetainedState::Unpack({}).has_value());
+}
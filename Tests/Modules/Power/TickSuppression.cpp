@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <TicklessIdle.hpp>
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+  constexpr uint32_t CyclesPerTick = 72000;
+  constexpr uint32_t MaxReload = 0x00FFFFFFU;
+
+  using SuppressionType = Power::TickSuppression<CyclesPerTick, MaxReload>;
+
+  /// @brief Simulated SysTick timer with a software tick counter incremented by its interrupt.
+  /// @details The timer behaves like the hardware: it loads the reload value on the first cycle after being cleared
+  ///          and raises its interrupt when the value changes from one to zero.
+  class SimulatedSysTick
+  {
+   public:
+    uint32_t load = CyclesPerTick - 1;
+    uint32_t value = 0;
+    bool enabled = true;
+    bool countFlag = false;
+    bool pending = false;
+
+    /// @brief Tick counter, incremented by the interrupt handler.
+    uint32_t ticks = 0;
+
+    /// @brief Total simulated cycles.
+    uint64_t cycles = 0;
+
+    /// @brief Advances the timer by a number of cycles while interrupts are masked.
+    void Advance(uint64_t count)
+    {
+      cycles += count;
+
+      while (enabled && count > 0)
+      {
+        if (value == 0)
+        {
+          value = load;
+          --count;
+          continue;
+        }
+
+        const auto step = std::min<uint64_t>(count, value);
+        value -= static_cast<uint32_t>(step);
+        count -= step;
+
+        if (value == 0)
+        {
+          countFlag = true;
+          pending = true;
+        }
+      }
+    }
+
+    /// @brief Advances the timer with interrupts enabled, running the handler on every expiry.
+    void Run(uint64_t count)
+    {
+      while (count > 0)
+      {
+        const auto step = std::min<uint64_t>(count, std::max<uint32_t>(value, 1));
+        Advance(step);
+        count -= step;
+        ServiceInterrupt();
+      }
+    }
+
+    /// @brief Runs the interrupt handler if the interrupt is pending.
+    void ServiceInterrupt()
+    {
+      if (pending)
+      {
+        pending = false;
+        ++ticks;
+      }
+    }
+
+    /// @brief Reads the control register, clearing the count flag.
+    bool ReadCountFlag()
+    {
+      const auto flag = countFlag;
+      countFlag = false;
+      return flag;
+    }
+
+    /// @brief Sleeps like `ResetAndClockControl::Idle` until the deadline or until the wake up after the given cycles.
+    Power::SuppressionResult Idle(const uint32_t deadline, const uint64_t wakeAfter)
+    {
+      const auto idleTicks = static_cast<int32_t>(deadline - ticks);
+      enabled = false;
+
+      ReadCountFlag();
+
+      if (pending || value == 0 || idleTicks <= 0)
+      {
+        enabled = true;
+        return {};
+      }
+
+      const auto plan = SuppressionType::Plan(static_cast<uint32_t>(idleTicks), value);
+      load = plan.reload;
+      value = 0;
+      enabled = true;
+
+      // Sleep until the timer expires or another interrupt wakes the core up
+      uint64_t slept = 0;
+
+      while (!pending && slept < wakeAfter)
+      {
+        const auto step = std::min<uint64_t>(wakeAfter - slept, std::max<uint32_t>(value, 1));
+        Advance(step);
+        slept += step;
+      }
+
+      enabled = false;
+      const auto result = SuppressionType::Resume(plan, ReadCountFlag(), value);
+
+      // The timer loads the shortened reload with its first cycle, before the periodic reload is written
+      load = std::max<uint32_t>(result.cyclesToNextTick, 2) - 1;
+      value = 0;
+      enabled = true;
+      Advance(1);
+      ticks += result.tickCompensation;
+      load = CyclesPerTick - 1;
+
+      ServiceInterrupt();
+
+      return result;
+    }
+
+    /// @brief Returns the tick derived from the simulated wall clock.
+    uint32_t WallClockTicks() const
+    {
+      return static_cast<uint32_t>(cycles / CyclesPerTick);
+    }
+  };
+}  // namespace
+
+TEST(TickSuppression, PlansReloadForTheRequestedTicks)
+{
+  const auto plan = SuppressionType::Plan(10, CyclesPerTick);
+
+  EXPECT_EQ(plan.ticks, 10U);
+  EXPECT_EQ(plan.reload, (10U * CyclesPerTick) - 1);
+}
+
+TEST(TickSuppression, LimitsSuppressedTicksToTimerRange)
+{
+  const auto plan = SuppressionType::Plan(1000, CyclesPerTick);
+
+  EXPECT_EQ(SuppressionType::MaxTicks, MaxReload / CyclesPerTick);
+  EXPECT_EQ(plan.ticks, SuppressionType::MaxTicks);
+  EXPECT_LE(plan.reload, MaxReload);
+}
+
+TEST(TickSuppression, IncludesRemainderOfCurrentTick)
+{
+  const auto plan = SuppressionType::Plan(3, 1000);
+
+  EXPECT_EQ(plan.reload, 1000U + (2U * CyclesPerTick) - 1);
+}
+
+TEST(TickSuppression, LeavesLastTickToPendingInterruptAfterExpiry)
+{
+  const auto plan = SuppressionType::Plan(5, CyclesPerTick);
+  const auto result = SuppressionType::Resume(plan, true, 0);
+
+  EXPECT_EQ(result.completedTicks, 5U);
+  EXPECT_EQ(result.tickCompensation, 4U);
+  EXPECT_EQ(result.cyclesToNextTick, CyclesPerTick);
+}
+
+TEST(TickSuppression, CompensatesPartialSleepAfterEarlyWakeup)
+{
+  const auto plan = SuppressionType::Plan(5, 500);
+  // Woken up 500 + 2.5 ticks after the start of the sleep
+  const auto slept = 500 + (CyclesPerTick * 5 / 2);
+  const auto result = SuppressionType::Resume(plan, false, plan.reload + 1 - slept);
+
+  EXPECT_EQ(result.sleptCycles, slept);
+  EXPECT_EQ(result.completedTicks, 3U);
+  EXPECT_EQ(result.tickCompensation, 3U);
+  EXPECT_EQ(result.cyclesToNextTick, CyclesPerTick / 2);
+}
+
+TEST(TickSuppression, KeepsWallClockAcrossSuppressedTicks)
+{
+  SimulatedSysTick sysTick;
+  sysTick.Run(CyclesPerTick / 3);
+
+  // Alternate sleeps until the deadline, sleeps cut short by other interrupts and busy periods
+  for (uint32_t i = 0; i < 200; ++i)
+  {
+    const auto deadline = sysTick.ticks + 1 + (i * 7) % 300;
+    const uint64_t wakeAfter = (i % 3 == 0) ? (i * 12345U) % (CyclesPerTick * 20) : UINT64_MAX;
+
+    sysTick.Idle(deadline, wakeAfter);
+    EXPECT_EQ(sysTick.ticks, sysTick.WallClockTicks()) << "Iteration " << i;
+
+    sysTick.Run((i * 997U) % CyclesPerTick);
+    EXPECT_EQ(sysTick.ticks, sysTick.WallClockTicks()) << "Iteration " << i;
+  }
+}
+
+TEST(TickSuppression, WakesUpAtTheDeadline)
+{
+  SimulatedSysTick sysTick;
+  sysTick.Run(CyclesPerTick * 2 + 10);
+
+  const auto deadline = sysTick.ticks + 50;
+  sysTick.Idle(deadline, UINT64_MAX);
+
+  EXPECT_EQ(sysTick.ticks, deadline);
+  EXPECT_EQ(sysTick.WallClockTicks(), deadline);
+}
+
+TEST(TickSuppression, AdvancesTheTickStoppedForTheStopMode)
+{
+  // Woken up within the tick in progress
+  static_assert(Power::AdvanceStoppedTick(500, 200, CyclesPerTick).completedTicks == 0);
+  static_assert(Power::AdvanceStoppedTick(500, 200, CyclesPerTick).cyclesToNextTick == 300);
+
+  // The boundary of the tick in progress counts as first tick
+  static_assert(Power::AdvanceStoppedTick(500, 500, CyclesPerTick).completedTicks == 1);
+  static_assert(Power::AdvanceStoppedTick(500, 500, CyclesPerTick).cyclesToNextTick == CyclesPerTick);
+
+  // Several seconds measured by the real time clock
+  constexpr auto progress = Power::AdvanceStoppedTick(500, (uint64_t {CyclesPerTick} * 3000) + 600, CyclesPerTick);
+  static_assert(progress.completedTicks == 3001);
+  static_assert(progress.cyclesToNextTick == CyclesPerTick - 100);
+}
+
+TEST(IdleResidency, ReportsSleepTimeOfLastWindow)
+{
+  Power::IdleResidency<CyclesPerTick, 1000> residency;
+
+  residency.Record(100, CyclesPerTick * 90);
+  residency.Record(600, CyclesPerTick * 400);
+  EXPECT_EQ(residency.GetStatistics().lastWindowSleptMilliseconds, 0U);
+
+  residency.Record(1005, CyclesPerTick * 300);
+  EXPECT_EQ(residency.GetStatistics().lastWindowSleptMilliseconds, 790U);
+  EXPECT_EQ(residency.GetStatistics().entries, 3U);
+  EXPECT_EQ(residency.GetStatistics().sleptCycles, uint64_t {CyclesPerTick} * 790);
+
+  residency.Record(2001, CyclesPerTick * 10);
+  EXPECT_EQ(residency.GetStatistics().lastWindowSleptMilliseconds, 10U);
+}
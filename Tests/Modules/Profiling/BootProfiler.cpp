@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <BootProfiler.hpp>
+#include <cstdint>
+
+using Profiling::BootMilestone;
+
+namespace
+{
+  constexpr uint32_t MHz = 1'000'000;
+}  // namespace
+
+TEST(BootProfiler, ConvertsEveryIntervalWithItsCoreClock)
+{
+  Profiling::BootProfiler profiler;
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::MainEntered), 0U);
+
+  // The reset handler and the first tasks run from the internal oscillator
+  profiler.Record(BootMilestone::MainEntered, 800, 8 * MHz);
+  profiler.Record(BootMilestone::FirstOutput, 8800, 8 * MHz);
+
+  // The clock is switched in between, the interval is converted with the old clock
+  profiler.Record(BootMilestone::ClocksReady, 16800, 72 * MHz);
+  profiler.Record(BootMilestone::TasksReady, 16800 + (72 * 500), 72 * MHz);
+
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::MainEntered), 100U);
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::FirstOutput), 1100U);
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::ClocksReady), 2100U);
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::TasksReady), 2600U);
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::FirstDispatch), 0U);
+}
+
+TEST(BootProfiler, RecordsEachMilestoneOnce)
+{
+  Profiling::BootProfiler profiler;
+
+  profiler.Record(BootMilestone::MainEntered, 8000, 72 * MHz);
+  profiler.Record(BootMilestone::FirstDispatch, 8000 + (72 * 1000), 72 * MHz);
+  profiler.Record(BootMilestone::FirstDispatch, 8000 + (72 * 5000), 72 * MHz);
+
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::MainEntered), 1000U);
+  EXPECT_EQ(profiler.GetMicroseconds(BootMilestone::FirstDispatch), 2000U);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <TaskProfiler.hpp>
+#include <cstdint>
+
+namespace
+{
+  /// @brief Fake task counting its runs.
+  struct FakeTask
+  {
+    static constexpr uint32_t Period = 10;
+    static constexpr uint32_t Phase = 3;
+    static constexpr uint32_t Budget = 100;
+
+    uint32_t runs = 0;
+
+    void Run()
+    {
+      ++runs;
+    }
+  };
+}  // namespace
+
+TEST(CycleStatistics, TracksMinimumMaximumMeanAndOverruns)
+{
+  Profiling::CycleStatistics statistics;
+  EXPECT_EQ(statistics.GetMean(), 0U);
+
+  statistics.Record(100, 250);
+  statistics.Record(300, 250);
+  statistics.Record(200, 250);
+  statistics.Record(250, 250);
+
+  EXPECT_EQ(statistics.runs, 4U);
+  EXPECT_EQ(statistics.minimum, 100U);
+  EXPECT_EQ(statistics.maximum, 300U);
+  EXPECT_EQ(statistics.GetMean(), 212U);
+  EXPECT_EQ(statistics.overruns, 1U);
+}
+
+TEST(CycleStatistics, SumsWithoutOverflow)
+{
+  Profiling::CycleStatistics statistics;
+
+  for (auto i = 0; i < 10; ++i)
+  {
+    statistics.Record(UINT32_MAX - 1, UINT32_MAX);
+  }
+
+  EXPECT_EQ(statistics.GetMean(), UINT32_MAX - 1);
+  EXPECT_EQ(statistics.overruns, 0U);
+}
+
+TEST(TaskProfiler, KeepsStatisticsPerTask)
+{
+  Profiling::TaskProfiler profiler;
+
+  profiler.Record(Profiling::TaskId::Leds, 40, 100);
+  profiler.Record(Profiling::TaskId::Display, 500, 100);
+
+  EXPECT_EQ(profiler.GetStatistics(Profiling::TaskId::Print).runs, 0U);
+  EXPECT_EQ(profiler.GetStatistics(Profiling::TaskId::Leds).maximum, 40U);
+  EXPECT_EQ(profiler.GetStatistics(Profiling::TaskId::Display).overruns, 1U);
+}
+
+TEST(TaskProfiler, InstrumentedTaskKeepsTheSchedule)
+{
+  FakeTask task;
+  auto profiled = Profiling::Profiled<Profiling::TaskId::Leds, FakeTask, 72>(task);
+  const auto runs = Profiling::taskProfiler.GetStatistics(Profiling::TaskId::Leds).runs;
+
+  static_assert(decltype(profiled)::Period == FakeTask::Period);
+  static_assert(decltype(profiled)::Phase == FakeTask::Phase);
+  static_assert(decltype(profiled)::Budget == FakeTask::Budget);
+
+  profiled.Run();
+  EXPECT_EQ(task.runs, 1U);
+
+  if constexpr (Profiling::Enabled)
+  {
+    EXPECT_EQ(Profiling::taskProfiler.GetStatistics(Profiling::TaskId::Leds).runs, runs + 1);
+  }
+  else
+  {
+    EXPECT_EQ(Profiling::taskProfiler.GetStatistics(Profiling::TaskId::Leds).runs, runs);
+  }
+}
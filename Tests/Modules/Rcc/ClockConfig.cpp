@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <ClockConfig.hpp>
+#include <cstdint>
+#include <set>
+
+using Peripherals::Rcc::ClockSource;
+
+namespace
+{
+  constexpr uint32_t MHz = 1'000'000;
+
+  /// @brief Returns the system clocks reachable with the 8 MHz crystal.
+  std::set<uint32_t> GetReachableClocks()
+  {
+    std::set<uint32_t> clocks;
+
+    for (uint32_t multiplier = 2; multiplier <= 16; ++multiplier)
+    {
+      // Crystal, halved crystal and halved internal oscillator
+      for (const uint32_t input : {8 * MHz, 4 * MHz})
+      {
+        if (input * multiplier <= 72 * MHz && input * multiplier >= 16 * MHz)
+        {
+          clocks.insert(input * multiplier);
+        }
+      }
+    }
+
+    clocks.insert(8 * MHz);
+    return clocks;
+  }
+
+  /// @brief Decodes a bus divider from the three prescaler bits of APB1 or APB2.
+  uint32_t DecodeBusDivider(const uint32_t bits)
+  {
+    return (bits & 0b100U) == 0 ? 1U : 2U << (bits & 0b011U);
+  }
+
+  /// @brief Returns the system clock generated by the configuration register value.
+  uint32_t DecodeSystemClock(const uint32_t cfgr)
+  {
+    switch (cfgr & RCC_CFGR_SW)
+    {
+      case RCC_CFGR_SW_HSI:
+        return Peripherals::Rcc::HsiFrequency;
+      case RCC_CFGR_SW_HSE:
+        return Peripherals::Rcc::HseFrequency;
+      default:
+        break;
+    }
+
+    auto input = Peripherals::Rcc::HsiFrequency / 2;
+
+    if ((cfgr & RCC_CFGR_PLLSRC) != 0)
+    {
+      input = (cfgr & RCC_CFGR_PLLXTPRE) != 0 ? Peripherals::Rcc::HseFrequency / 2 : Peripherals::Rcc::HseFrequency;
+    }
+
+    return input * (((cfgr & RCC_CFGR_PLLMULL) >> RCC_CFGR_PLLMULL_Pos) + 2);
+  }
+}  // namespace
+
+TEST(ClockConfig, ReproducesTheClockTreeOfTheBoard)
+{
+  constexpr auto config = Peripherals::Rcc::MakeClockConfig<72 * MHz>();
+
+  static_assert(config.source == ClockSource::Pll);
+  static_assert(config.pllFromHse && !config.hseDividedByTwo);
+  static_assert(config.pllMultiplier == 9);
+  static_assert(config.ahbClock == 72 * MHz);
+  static_assert(config.apb1Clock == 36 * MHz);
+  static_assert(config.apb2Clock == 72 * MHz);
+  static_assert(config.apb1TimerClock == 72 * MHz);
+  static_assert(config.adcClock == 12 * MHz);
+  static_assert(config.flashLatency == 2);
+  static_assert(config.usbAvailable);
+  static_assert(config.GetConfigurationRegister() == (RCC_CFGR_PLLMULL9 | RCC_CFGR_PLLSRC | RCC_CFGR_PPRE1_DIV2 |
+                                                       RCC_CFGR_ADCPRE_DIV6 | RCC_CFGR_SW_PLL));
+  static_assert(config.GetFlashAccessRegister() == (FLASH_ACR_LATENCY_1 | FLASH_ACR_PRFTBE));
+}
+
+TEST(ClockConfig, UsesTheOscillatorsDirectly)
+{
+  constexpr auto hsi = Peripherals::Rcc::SolveClockConfig(8 * MHz, 0);
+  constexpr auto hse = Peripherals::Rcc::SolveClockConfig(8 * MHz);
+
+  static_assert(hsi.valid && hsi.source == ClockSource::Hsi);
+  static_assert(hse.valid && hse.source == ClockSource::Hse);
+  static_assert(hse.apb1Divider == 1 && hse.apb1TimerClock == 8 * MHz);
+  static_assert(hse.flashLatency == 0);
+  static_assert(!hse.usbAvailable);
+}
+
+TEST(ClockConfig, SolvesEveryReachableSystemClock)
+{
+  const auto reachable = GetReachableClocks();
+
+  for (uint32_t systemClock = 500'000; systemClock <= 80 * MHz; systemClock += 500'000)
+  {
+    const auto config = Peripherals::Rcc::SolveClockConfig(systemClock);
+
+    ASSERT_EQ(config.valid, reachable.contains(systemClock)) << systemClock;
+
+    if (!config.valid)
+    {
+      continue;
+    }
+
+    const auto cfgr = config.GetConfigurationRegister();
+
+    // The register values generate the frequencies the drivers derive their dividers from
+    EXPECT_EQ(DecodeSystemClock(cfgr), systemClock);
+    EXPECT_EQ(config.ahbClock, systemClock);
+    EXPECT_EQ(DecodeBusDivider((cfgr & RCC_CFGR_PPRE1) >> RCC_CFGR_PPRE1_Pos), config.apb1Divider);
+    EXPECT_EQ(DecodeBusDivider((cfgr & RCC_CFGR_PPRE2) >> RCC_CFGR_PPRE2_Pos), config.apb2Divider);
+    EXPECT_EQ((((cfgr & RCC_CFGR_ADCPRE) >> RCC_CFGR_ADCPRE_Pos) + 1) * 2, config.adcDivider);
+    EXPECT_EQ(cfgr & RCC_CFGR_HPRE, RCC_CFGR_HPRE_DIV1);
+
+    // Every bus within its limit and not divided further than needed
+    EXPECT_LE(config.apb1Clock, 36 * MHz);
+
+    if (config.apb1Divider > 1)
+    {
+      EXPECT_GT(config.apb1Clock * 2, 36 * MHz);
+    }
+
+    EXPECT_EQ(config.apb2Clock, systemClock);
+    EXPECT_LE(config.adcClock, 14 * MHz);
+    EXPECT_EQ(config.apb1TimerClock, systemClock);
+    EXPECT_EQ(config.flashLatency, systemClock <= 24 * MHz ? 0U : (systemClock <= 48 * MHz ? 1U : 2U));
+    EXPECT_EQ(config.usbAvailable, systemClock == 48 * MHz || systemClock == 72 * MHz);
+
+    if (config.usbAvailable)
+    {
+      EXPECT_EQ((cfgr & RCC_CFGR_USBPRE) != 0, systemClock == 48 * MHz);
+    }
+  }
+}
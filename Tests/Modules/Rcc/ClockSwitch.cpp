@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+
+#include <ClockSwitch.hpp>
+#include <Rcc.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using Peripherals::Rcc::ClockConfig;
+using Peripherals::Rcc::ClockProfile;
+using Peripherals::Rcc::ClockSource;
+using RccType = Peripherals::Rcc::ResetAndClockControl;
+
+namespace
+{
+  constexpr uint32_t MHz = 1'000'000;
+
+  /// @brief Bits of the clock configuration register which may only change while the PLL is off.
+  constexpr uint32_t PllConfigurationMask = RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL;
+
+  /// @brief Simulated RCC and flash interface checking the limits of the clock tree after every register write.
+  /// @details The oscillators are ready as soon as they are enabled and the system clock switches immediately. It
+  ///          provides the registers of both blocks, so it is passed as RCC and as flash register block.
+  class SimulatedClockTree
+  {
+   public:
+    /// @brief Register calling back into the simulation on every write.
+    class Register
+    {
+     private:
+      SimulatedClockTree& tree;
+      uint32_t value;
+
+     public:
+      Register(SimulatedClockTree& tree, const uint32_t value) : tree(tree), value(value)
+      {
+      }
+
+      operator uint32_t() const  // NOLINT(google-explicit-constructor)
+      {
+        return value;
+      }
+
+      // The bit masks of the device header are 64 bit wide on the host
+      Register& operator=(const uint64_t written)
+      {
+        const auto previous = value;
+        value = static_cast<uint32_t>(written);
+        tree.Update(*this, previous);
+        return *this;
+      }
+
+      Register& operator|=(const uint64_t bits)
+      {
+        return *this = value | bits;
+      }
+
+      Register& operator&=(const uint64_t bits)
+      {
+        return *this = value & bits;
+      }
+
+      /// @brief Sets the value without a write access, as the hardware does for the status bits.
+      void SetStatus(const uint32_t status)
+      {
+        value = status;
+      }
+    };
+
+    // Register names as in the CMSIS device header
+    // NOLINTBEGIN(readability-identifier-naming)
+    Register CR {*this, RCC_CR_HSION | RCC_CR_HSIRDY};
+    Register CFGR {*this, 0};
+    Register ACR {*this, FLASH_ACR_PRFTBE};
+    // NOLINTEND(readability-identifier-naming)
+
+    /// @brief Violated limits and forbidden register writes in the order they occurred.
+    std::vector<std::string> violations;
+
+    /// @brief Returns the current system clock.
+    /// @return System clock in Hz.
+    uint32_t GetSystemClock() const
+    {
+      switch ((CFGR & RCC_CFGR_SWS) >> RCC_CFGR_SWS_Pos)
+      {
+        case RCC_CFGR_SW_HSI:
+          return Peripherals::Rcc::HsiFrequency;
+        case RCC_CFGR_SW_HSE:
+          return Peripherals::Rcc::HseFrequency;
+        default:
+          return GetPllClock();
+      }
+    }
+
+    /// @brief Returns the current APB1 clock.
+    /// @return APB1 clock in Hz.
+    uint32_t GetApb1Clock() const
+    {
+      const auto bits = (CFGR & RCC_CFGR_PPRE1) >> RCC_CFGR_PPRE1_Pos;
+      return GetSystemClock() / ((bits & 0b100U) == 0 ? 1U : 2U << (bits & 0b011U));
+    }
+
+   private:
+    /// @brief Returns the output frequency of the PLL.
+    uint32_t GetPllClock() const
+    {
+      auto input = Peripherals::Rcc::HsiFrequency / 2;
+
+      if ((CFGR & RCC_CFGR_PLLSRC) != 0)
+      {
+        input = (CFGR & RCC_CFGR_PLLXTPRE) != 0 ? Peripherals::Rcc::HseFrequency / 2 : Peripherals::Rcc::HseFrequency;
+      }
+
+      return input * (((CFGR & RCC_CFGR_PLLMULL) >> RCC_CFGR_PLLMULL_Pos) + 2);
+    }
+
+    /// @brief Applies the hardware reaction to a register write and checks the limits afterwards.
+    void Update(const Register& written, const uint32_t previous)
+    {
+      const auto selected = (CFGR & RCC_CFGR_SWS) >> RCC_CFGR_SWS_Pos;
+      const auto hseInUse =
+        selected == RCC_CFGR_SW_HSE || (selected == RCC_CFGR_SW_PLL && (CFGR & RCC_CFGR_PLLSRC) != 0);
+
+      if (&written == &CR)
+      {
+        if ((CR & RCC_CR_PLLON) == 0 && selected == RCC_CFGR_SW_PLL)
+        {
+          violations.emplace_back("PLL stopped while it drives the system clock");
+        }
+
+        if ((CR & RCC_CR_HSEON) == 0 && hseInUse)
+        {
+          violations.emplace_back("HSE stopped while it is in use");
+        }
+
+        if ((CR & RCC_CR_PLLON) != 0 && (previous & RCC_CR_PLLON) == 0 && (CFGR & RCC_CFGR_PLLSRC) != 0 &&
+            (CR & RCC_CR_HSERDY) == 0)
+        {
+          violations.emplace_back("PLL started without its input");
+        }
+
+        // The oscillators lock immediately
+        auto status = CR & ~(RCC_CR_HSERDY | RCC_CR_PLLRDY);
+        status |= (CR & RCC_CR_HSEON) != 0 ? RCC_CR_HSERDY : 0U;
+        status |= (CR & RCC_CR_PLLON) != 0 ? RCC_CR_PLLRDY : 0U;
+        CR.SetStatus(status);
+      }
+      else if (&written == &CFGR)
+      {
+        if ((CR & RCC_CR_PLLON) != 0 && ((CFGR ^ previous) & PllConfigurationMask) != 0)
+        {
+          violations.emplace_back("PLL reconfigured while running");
+        }
+
+        const auto requested = CFGR & RCC_CFGR_SW;
+
+        if ((requested == RCC_CFGR_SW_HSE && (CR & RCC_CR_HSERDY) == 0) ||
+            (requested == RCC_CFGR_SW_PLL && (CR & RCC_CR_PLLRDY) == 0))
+        {
+          violations.emplace_back("Clock source selected before it is ready");
+        }
+
+        // The status follows the selection immediately
+        CFGR.SetStatus((CFGR & ~RCC_CFGR_SWS) | (requested << RCC_CFGR_SWS_Pos));
+      }
+
+      const auto systemClock = GetSystemClock();
+      const auto latency = (ACR & FLASH_ACR_LATENCY) >> FLASH_ACR_LATENCY_Pos;
+
+      if (systemClock > Peripherals::Rcc::MaxSystemClock)
+      {
+        violations.emplace_back("System clock of " + std::to_string(systemClock) + " Hz");
+      }
+
+      if (systemClock > (latency + 1) * Peripherals::Rcc::FlashClockPerWaitState)
+      {
+        violations.emplace_back(std::to_string(latency) + " wait states at " + std::to_string(systemClock) + " Hz");
+      }
+
+      if (GetApb1Clock() > Peripherals::Rcc::MaxApb1Clock)
+      {
+        violations.emplace_back("APB1 clock of " + std::to_string(GetApb1Clock()) + " Hz");
+      }
+    }
+  };
+
+  using SimulatedClockSwitch = Peripherals::Rcc::ClockSwitch<SimulatedClockTree, SimulatedClockTree>;
+
+  /// @brief Switches the simulated clock tree from one configuration to another.
+  void Switch(SimulatedClockTree& tree, const ClockConfig& from, const ClockConfig& to)
+  {
+    auto clockSwitch = SimulatedClockSwitch(tree, tree);
+    clockSwitch.Prepare(from, to);
+    clockSwitch.Select(to);
+    clockSwitch.Finish(from, to);
+  }
+
+  /// @brief Expects the simulated clock tree to be configured as given and to run no unneeded oscillator.
+  void ExpectConfigured(const SimulatedClockTree& tree, const ClockConfig& config)
+  {
+    EXPECT_EQ(tree.GetSystemClock(), config.systemClock);
+    EXPECT_EQ(tree.GetApb1Clock(), config.apb1Clock);
+    EXPECT_EQ(tree.CFGR & ~RCC_CFGR_SWS, config.GetConfigurationRegister());
+    EXPECT_EQ(static_cast<uint32_t>(tree.ACR), config.GetFlashAccessRegister());
+    EXPECT_EQ((tree.CR & RCC_CR_PLLON) != 0, config.source == ClockSource::Pll);
+    EXPECT_EQ((tree.CR & RCC_CR_HSEON) != 0, Peripherals::Rcc::UsesHse(config));
+  }
+}  // namespace
+
+TEST(ClockSwitch, StartsFromTheResetConfiguration)
+{
+  SimulatedClockTree tree;
+  ExpectConfigured(tree, Peripherals::Rcc::ResetClockConfig);
+
+  Switch(tree, Peripherals::Rcc::ResetClockConfig, RccType::Clocks);
+
+  ExpectConfigured(tree, RccType::Clocks);
+  EXPECT_EQ(tree.violations, std::vector<std::string> {});
+}
+
+TEST(ClockSwitch, SwitchesBetweenTheProfiles)
+{
+  const auto& low = RccType::Profiles[static_cast<std::size_t>(ClockProfile::Low)];
+  const auto& high = RccType::Profiles[static_cast<std::size_t>(ClockProfile::High)];
+
+  static_assert(RccType::GetTicks(ClockProfile::Low) == 8000);
+  static_assert(RccType::GetTicks(ClockProfile::High) == RccType::Ticks);
+
+  SimulatedClockTree tree;
+  Switch(tree, Peripherals::Rcc::ResetClockConfig, high);
+
+  for (auto i = 0; i < 3; ++i)
+  {
+    Switch(tree, high, low);
+    ExpectConfigured(tree, low);
+
+    Switch(tree, low, high);
+    ExpectConfigured(tree, high);
+  }
+
+  EXPECT_EQ(tree.violations, std::vector<std::string> {});
+}
+
+TEST(ClockSwitch, KeepsTheLimitsBetweenAllConfigurations)
+{
+  std::vector<ClockConfig> configs = {Peripherals::Rcc::SolveClockConfig(8 * MHz, 0)};
+
+  for (uint32_t systemClock = 4 * MHz; systemClock <= 72 * MHz; systemClock += 4 * MHz)
+  {
+    if (const auto config = Peripherals::Rcc::SolveClockConfig(systemClock); config.valid)
+    {
+      configs.push_back(config);
+    }
+  }
+
+  for (const auto& from : configs)
+  {
+    for (const auto& to : configs)
+    {
+      // Two PLL configurations are switched through an oscillator
+      if (from.source == ClockSource::Pll && to.source == ClockSource::Pll)
+      {
+        continue;
+      }
+
+      SimulatedClockTree tree;
+      Switch(tree, Peripherals::Rcc::ResetClockConfig, from);
+      Switch(tree, from, to);
+
+      ExpectConfigured(tree, to);
+      EXPECT_EQ(tree.violations, std::vector<std::string> {}) << from.systemClock << " to " << to.systemClock;
+    }
+  }
+}
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#include <Rcc.hpp>
+#include <Timer.hpp>
+#include <Usart.hpp>
+
+using RccType = Peripherals::Rcc::ResetAndClockControl;
+using TimerType = Peripherals::Timer::Timer;
+using UsartType = Peripherals::Usart::UniversalSynchronousAsynchronousReceiverTransmitter;
+
+namespace
+{
+  // The addresses are constant expressions, so the accessors need neither a guard nor a constructor call
+  constexpr auto* Rcc = &RccType::GetInstance();
+  constexpr auto* Usart1 = &UsartType::GetInstance<Peripherals::Usart::UsartInstance::Usart1>();
+  constexpr auto* Usart3 = &UsartType::GetInstance<Peripherals::Usart::UsartInstance::Usart3>();
+  constexpr auto* Tim2 = &TimerType::GetInstance<Peripherals::Timer::TimerInstance::Tim2>();
+  constexpr auto* Tim4 = &TimerType::GetInstance<Peripherals::Timer::TimerInstance::Tim4>();
+}  // namespace
+
+TEST(StaticInstances, AreConstantInitializedBeforeInit)
+{
+  static_assert(Usart1 != Usart3);
+  static_assert(Tim2 != Tim4);
+
+  // Nothing is configured until the drivers are initialized explicitly
+  EXPECT_EQ(Rcc->GetSysTick(), 0U);
+  EXPECT_EQ(Rcc->GetClockProfile(), Peripherals::Rcc::ClockProfile::Low);
+  EXPECT_EQ(Rcc->GetClockSwitchStatistics().switches, 0U);
+  EXPECT_EQ(&RccType::GetInstance(), Rcc);
+  EXPECT_EQ(&UsartType::GetInstance<Peripherals::Usart::UsartInstance::Usart1>(), Usart1);
+}
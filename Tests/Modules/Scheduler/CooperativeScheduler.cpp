@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <Scheduler.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  /// @brief Virtual tick source, advanced manually by the tests.
+  struct VirtualTick
+  {
+    static inline uint32_t now = 0;
+
+    static uint32_t Now()
+    {
+      return now;
+    }
+  };
+
+  /// @brief Dispatch record of a fake task.
+  struct Dispatch
+  {
+    int id;
+    uint32_t tick;
+  };
+
+  std::vector<Dispatch> dispatches;
+
+  /// @brief Fake task recording its dispatches and consuming a configurable number of ticks.
+  template<int Id, uint32_t TaskPeriod, uint32_t TaskPhase, uint32_t Duration = 0>
+  struct FakeTask
+  {
+    static constexpr uint32_t Period = TaskPeriod;
+    static constexpr uint32_t Phase = TaskPhase;
+
+    void Run()
+    {
+      dispatches.push_back({Id, VirtualTick::now});
+      VirtualTick::now += Duration;
+    }
+  };
+
+  /// @brief Advances the virtual tick one by one and dispatches after every tick.
+  template<class Scheduler>
+  void RunUntil(Scheduler& scheduler, const uint32_t end)
+  {
+    while (VirtualTick::now < end)
+    {
+      scheduler.Dispatch();
+      ++VirtualTick::now;
+    }
+  }
+}  // namespace
+
+class CooperativeScheduler : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    VirtualTick::now = 0;
+    dispatches.clear();
+  }
+};
+
+TEST_F(CooperativeScheduler, DispatchesTasksAtTheirPeriodAndPhase)
+{
+  FakeTask<0, 10, 0> fast;
+  FakeTask<1, 1000, 5> slow;
+  auto scheduler = Scheduler::CooperativeScheduler<VirtualTick, 2>({
+    Scheduler::MakeTask(fast),
+    Scheduler::MakeTask(slow),
+  });
+
+  RunUntil(scheduler, 2000);
+
+  EXPECT_EQ(scheduler.GetStatistics(0).runs, 200U);
+  EXPECT_EQ(scheduler.GetStatistics(1).runs, 2U);
+  EXPECT_EQ(scheduler.GetStatistics(0).maxJitter, 0U);
+  EXPECT_EQ(scheduler.GetStatistics(1).maxJitter, 0U);
+
+  for (const auto& dispatch : dispatches)
+  {
+    if (dispatch.id == 0)
+    {
+      EXPECT_EQ(dispatch.tick % 10, 0U);
+    }
+    else
+    {
+      EXPECT_EQ(dispatch.tick % 1000, 5U);
+    }
+  }
+}
+
+TEST_F(CooperativeScheduler, DispatchesTasksDueAtTheSameTickInTableOrder)
+{
+  FakeTask<0, 10, 0> first;
+  FakeTask<1, 10, 0> second;
+  FakeTask<2, 20, 0> third;
+  auto scheduler = Scheduler::CooperativeScheduler<VirtualTick, 3>({
+    Scheduler::MakeTask(first),
+    Scheduler::MakeTask(second),
+    Scheduler::MakeTask(third),
+  });
+
+  RunUntil(scheduler, 11);
+
+  ASSERT_EQ(dispatches.size(), 5U);
+  EXPECT_EQ(dispatches[0].id, 0);
+  EXPECT_EQ(dispatches[1].id, 1);
+  EXPECT_EQ(dispatches[2].id, 2);
+  EXPECT_EQ(dispatches[3].id, 0);
+  EXPECT_EQ(dispatches[4].id, 1);
+  EXPECT_EQ(dispatches[3].tick, 10U);
+}
+
+TEST_F(CooperativeScheduler, LongTaskDelaysFollowingTasksByItsDuration)
+{
+  FakeTask<0, 10, 0> fast;
+  FakeTask<1, 100, 0, 3> slow;
+  auto scheduler = Scheduler::CooperativeScheduler<VirtualTick, 2>({
+    Scheduler::MakeTask(slow),
+    Scheduler::MakeTask(fast),
+  });
+
+  RunUntil(scheduler, 1000);
+
+  // The fast task waits for the slow one whenever both are due at the same tick
+  EXPECT_EQ(scheduler.GetStatistics(0).maxJitter, 0U);
+  EXPECT_EQ(scheduler.GetStatistics(1).maxJitter, 3U);
+  EXPECT_EQ(scheduler.GetStatistics(1).runs, 100U);
+  EXPECT_EQ(scheduler.GetStatistics(1).missedReleases, 0U);
+}
+
+TEST_F(CooperativeScheduler, SkipsReleasesMissedByOverrun)
+{
+  FakeTask<0, 10, 0> fast;
+  FakeTask<1, 1000, 0, 25> blocking;
+  auto scheduler = Scheduler::CooperativeScheduler<VirtualTick, 2>({
+    Scheduler::MakeTask(blocking),
+    Scheduler::MakeTask(fast),
+  });
+
+  scheduler.Dispatch();
+
+  EXPECT_EQ(VirtualTick::now, 25U);
+  EXPECT_EQ(scheduler.GetStatistics(1).missedReleases, 2U);
+  EXPECT_EQ(scheduler.GetStatistics(1).maxJitter, 25U);
+  EXPECT_EQ(scheduler.GetNextRelease(), 30U);
+}
+
+TEST_F(CooperativeScheduler, HandlesTickCounterWrapAround)
+{
+  VirtualTick::now = UINT32_MAX - 15;
+  FakeTask<0, 10, 0> task;
+  auto scheduler = Scheduler::CooperativeScheduler<VirtualTick, 1>({
+    Scheduler::MakeTask(task),
+  });
+
+  for (auto i = 0; i < 40; ++i)
+  {
+    scheduler.Dispatch();
+    ++VirtualTick::now;
+  }
+
+  EXPECT_EQ(scheduler.GetStatistics(0).runs, 4U);
+  EXPECT_EQ(scheduler.GetStatistics(0).maxJitter, 0U);
+}
+
+TEST_F(CooperativeScheduler, ReturnsEarliestNextRelease)
+{
+  FakeTask<0, 100, 40> first;
+  FakeTask<1, 100, 15> second;
+  auto scheduler = Scheduler::CooperativeScheduler<VirtualTick, 2>({
+    Scheduler::MakeTask(first),
+    Scheduler::MakeTask(second),
+  });
+
+  EXPECT_EQ(scheduler.GetNextRelease(), 15U);
+
+  RunUntil(scheduler, 16);
+
+  EXPECT_EQ(scheduler.GetNextRelease(), 40U);
+}
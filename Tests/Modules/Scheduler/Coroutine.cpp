@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <Coroutine.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  /// @brief Virtual tick source, advanced manually by the tests.
+  struct VirtualClock
+  {
+    static inline uint32_t now = 0;
+
+    static uint32_t Now()
+    {
+      return now;
+    }
+  };
+
+  using ExecutorType = Scheduler::CoroutineExecutor<VirtualClock, 4>;
+
+  std::vector<uint32_t> trace;
+
+  /// @brief Advances the virtual clock one by one and polls after every tick.
+  void RunUntil(ExecutorType& executor, const uint32_t end)
+  {
+    while (VirtualClock::now < end)
+    {
+      executor.Poll();
+      ++VirtualClock::now;
+    }
+  }
+
+  Scheduler::Task Blink(const uint32_t period, const uint32_t count)
+  {
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      trace.push_back(VirtualClock::now);
+      co_await Scheduler::SleepFor(period);
+    }
+  }
+
+  Scheduler::Task SendBit()
+  {
+    trace.push_back(VirtualClock::now);
+    co_await Scheduler::SleepFor(2);
+    trace.push_back(VirtualClock::now);
+  }
+
+  Scheduler::Task SendByte()
+  {
+    for (auto i = 0; i < 3; ++i)
+    {
+      co_await SendBit();
+    }
+  }
+
+  Scheduler::Task Transfer(bool& done)
+  {
+    co_await SendByte();
+    co_await SendByte();
+    done = true;
+  }
+
+  Scheduler::Task WaitForEvent(Scheduler::Event& event, uint32_t& wakeups)
+  {
+    for (;;)
+    {
+      co_await event;
+      ++wakeups;
+      trace.push_back(VirtualClock::now);
+    }
+  }
+
+  Scheduler::Task Periodic(const uint32_t period)
+  {
+    auto next = VirtualClock::now;
+
+    for (;;)
+    {
+      trace.push_back(VirtualClock::now);
+      // Simulate work, which must not delay the next release
+      VirtualClock::now += 3;
+      next += period;
+      co_await Scheduler::SleepUntil(next);
+    }
+  }
+}  // namespace
+
+class Coroutine : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    VirtualClock::now = 0;
+    trace.clear();
+  }
+
+  void TearDown() override
+  {
+    EXPECT_EQ(Scheduler::frameArena.GetUsedBlocks(), 0U);
+    EXPECT_EQ(Scheduler::frameArena.GetFailures(), 0U);
+  }
+};
+
+TEST_F(Coroutine, SleepsForTheRequestedTicks)
+{
+  ExecutorType executor;
+  ASSERT_TRUE(executor.Spawn(Blink(10, 4)));
+
+  RunUntil(executor, 100);
+
+  EXPECT_EQ(trace, (std::vector<uint32_t> {0, 10, 20, 30}));
+  EXPECT_EQ(executor.GetActiveTasks(), 0U);
+}
+
+TEST_F(Coroutine, NestedTasksSleepWithoutBlockingOthers)
+{
+  ExecutorType executor;
+  bool done = false;
+  ASSERT_TRUE(executor.Spawn(Transfer(done)));
+
+  RunUntil(executor, 5);
+
+  // The executor returns while the nested task sleeps
+  EXPECT_FALSE(done);
+  EXPECT_EQ(executor.GetNextWakeup(1000), 6U);
+
+  RunUntil(executor, 100);
+
+  EXPECT_TRUE(done);
+  ASSERT_EQ(trace.size(), 12U);
+
+  for (std::size_t i = 0; i < trace.size(); i += 2)
+  {
+    EXPECT_EQ(trace[i + 1] - trace[i], 2U);
+  }
+
+  EXPECT_EQ(trace.back(), 12U);
+}
+
+TEST_F(Coroutine, InterleavesTasks)
+{
+  ExecutorType executor;
+  bool done = false;
+  ASSERT_TRUE(executor.Spawn(Transfer(done)));
+  ASSERT_TRUE(executor.Spawn(Blink(1, 12)));
+
+  RunUntil(executor, 100);
+
+  EXPECT_TRUE(done);
+  EXPECT_EQ(trace.size(), 24U);
+  EXPECT_EQ(executor.GetActiveTasks(), 0U);
+}
+
+TEST_F(Coroutine, ResumesTaskWhenEventIsSet)
+{
+  ExecutorType executor;
+  Scheduler::Event event;
+  uint32_t wakeups = 0;
+  ASSERT_TRUE(executor.Spawn(WaitForEvent(event, wakeups)));
+
+  RunUntil(executor, 10);
+  EXPECT_EQ(wakeups, 0U);
+  EXPECT_EQ(executor.GetNextWakeup(1000), 1000U);
+
+  event.Set();
+  RunUntil(executor, 12);
+  EXPECT_EQ(wakeups, 1U);
+  EXPECT_EQ(trace, (std::vector<uint32_t> {10}));
+
+  event.Set();
+  event.Set();
+  RunUntil(executor, 20);
+  EXPECT_EQ(wakeups, 2U);
+}
+
+TEST_F(Coroutine, ReportsAReadyTaskWhenTheEventIsSetAfterPolling)
+{
+  ExecutorType executor;
+  Scheduler::Event event;
+  uint32_t wakeups = 0;
+  ASSERT_TRUE(executor.Spawn(WaitForEvent(event, wakeups)));
+  ASSERT_TRUE(executor.Spawn(Blink(100, 2)));
+
+  executor.Poll();
+  EXPECT_FALSE(executor.HasReadyTask());
+
+  // Set by an interrupt between polling and sleeping, the sleep has to be skipped
+  event.Set();
+  EXPECT_TRUE(executor.HasReadyTask());
+
+  executor.Poll();
+  EXPECT_EQ(wakeups, 1U);
+  EXPECT_FALSE(executor.HasReadyTask());
+}
+
+TEST_F(Coroutine, SleepUntilKeepsThePeriodIndependentOfTheWork)
+{
+  ExecutorType executor;
+  ASSERT_TRUE(executor.Spawn(Periodic(100)));
+
+  RunUntil(executor, 1000);
+
+  EXPECT_EQ(trace, (std::vector<uint32_t> {0, 100, 200, 300, 400, 500, 600, 700, 800, 900}));
+}
+
+TEST_F(Coroutine, FreesFramesOfCompletedTasks)
+{
+  ExecutorType executor;
+  bool done = false;
+  ASSERT_TRUE(executor.Spawn(Transfer(done)));
+
+  executor.Poll();
+  EXPECT_EQ(Scheduler::frameArena.GetUsedBlocks(), 3U);
+
+  RunUntil(executor, 100);
+  EXPECT_EQ(Scheduler::frameArena.GetUsedBlocks(), 0U);
+  EXPECT_GE(Scheduler::frameArena.GetHighWater(), 3U);
+}
+
+TEST(FrameArena, ReusesBlocksAndCountsFailures)
+{
+  Scheduler::FrameArena<16, 2> arena;
+
+  auto* first = arena.Allocate(16);
+  auto* second = arena.Allocate(8);
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(arena.Allocate(8), nullptr);
+  EXPECT_EQ(arena.Allocate(32), nullptr);
+  EXPECT_EQ(arena.GetFailures(), 2U);
+
+  arena.Deallocate(first);
+  EXPECT_EQ(arena.Allocate(4), first);
+  EXPECT_EQ(arena.GetHighWater(), 2U);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <StaticScheduler.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  /// @brief Virtual tick source, advanced manually by the tests.
+  struct VirtualTick
+  {
+    static inline uint32_t now = 0;
+
+    static uint32_t Now()
+    {
+      return now;
+    }
+  };
+
+  /// @brief Dispatch record of a fake task.
+  struct Dispatch
+  {
+    int id;
+    uint32_t tick;
+  };
+
+  std::vector<Dispatch> dispatches;
+
+  /// @brief Fake task recording its dispatches and consuming a configurable number of ticks.
+  template<int Id, uint32_t TaskPeriod, uint32_t TaskPhase, uint32_t TaskBudget, uint32_t Duration = 0>
+  struct FakeTask
+  {
+    static constexpr uint32_t Period = TaskPeriod;
+    static constexpr uint32_t Phase = TaskPhase;
+    static constexpr uint32_t Budget = TaskBudget;
+
+    void Run()
+    {
+      dispatches.push_back({Id, VirtualTick::now});
+      VirtualTick::now += Duration;
+    }
+  };
+
+  /// @brief Advances the virtual tick one by one and dispatches after every tick.
+  template<class Scheduler>
+  void RunUntil(Scheduler& scheduler, const uint32_t end)
+  {
+    while (VirtualTick::now < end)
+    {
+      scheduler.Dispatch();
+      ++VirtualTick::now;
+    }
+  }
+
+  using Fast = FakeTask<0, 10, 0, 1000>;
+  using Slow = FakeTask<1, 1000, 5, 100000>;
+  using Overloaded = FakeTask<2, 100, 0, 90000>;
+
+  // 1 ms out of 10 ms plus 100 ms out of 1000 ms
+  static_assert(Scheduler::GetUtilization<Fast, Slow>() > 0.199 && Scheduler::GetUtilization<Fast, Slow>() < 0.201);
+  static_assert(Scheduler::GetRateMonotonicBound(1) > 0.999 && Scheduler::GetRateMonotonicBound(1) < 1.001);
+  static_assert(Scheduler::GetRateMonotonicBound(2) > 0.828 && Scheduler::GetRateMonotonicBound(2) < 0.829);
+  static_assert(Scheduler::GetRateMonotonicBound(3) > 0.779 && Scheduler::GetRateMonotonicBound(3) < 0.780);
+  static_assert(Scheduler::IsRateMonotonicSchedulable<Fast, Slow>());
+  static_assert(!Scheduler::IsRateMonotonicSchedulable<Fast, Overloaded>());
+  static_assert(Scheduler::IsRateMonotonicOrder<Fast, Slow>());
+  static_assert(!Scheduler::IsRateMonotonicOrder<Slow, Fast>());
+}  // namespace
+
+class StaticScheduler : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    VirtualTick::now = 0;
+    dispatches.clear();
+  }
+};
+
+TEST_F(StaticScheduler, DispatchesTasksAtTheirPeriodAndPhase)
+{
+  Fast fast;
+  Slow slow;
+  auto scheduler = Scheduler::StaticScheduler<VirtualTick, Fast, Slow>(fast, slow);
+
+  RunUntil(scheduler, 2000);
+
+  EXPECT_EQ(scheduler.GetStatistics(0).runs, 200U);
+  EXPECT_EQ(scheduler.GetStatistics(1).runs, 2U);
+  EXPECT_EQ(scheduler.GetStatistics(0).maxJitter, 0U);
+  EXPECT_EQ(scheduler.GetStatistics(1).maxJitter, 0U);
+
+  for (const auto& dispatch : dispatches)
+  {
+    EXPECT_EQ(dispatch.tick % (dispatch.id == 0 ? 10 : 1000), dispatch.id == 0 ? 0U : 5U);
+  }
+}
+
+TEST_F(StaticScheduler, DispatchesTasksDueAtTheSameTickInTableOrder)
+{
+  FakeTask<0, 10, 0, 100> first;
+  FakeTask<1, 10, 0, 100> second;
+  FakeTask<2, 20, 0, 100> third;
+  auto scheduler = Scheduler::StaticScheduler<VirtualTick, decltype(first), decltype(second), decltype(third)>(
+    first, second, third);
+
+  EXPECT_EQ(scheduler.Dispatch(), 3U);
+  VirtualTick::now = 10;
+  EXPECT_EQ(scheduler.Dispatch(), 2U);
+
+  ASSERT_EQ(dispatches.size(), 5U);
+  EXPECT_EQ(dispatches[0].id, 0);
+  EXPECT_EQ(dispatches[1].id, 1);
+  EXPECT_EQ(dispatches[2].id, 2);
+  EXPECT_EQ(dispatches[3].id, 0);
+  EXPECT_EQ(dispatches[4].id, 1);
+}
+
+TEST_F(StaticScheduler, SkipsReleasesMissedByOverrun)
+{
+  FakeTask<0, 10, 0, 1000, 25> blocking;
+  FakeTask<1, 10, 0, 1000> fast;
+  auto scheduler = Scheduler::StaticScheduler<VirtualTick, decltype(blocking), decltype(fast)>(blocking, fast);
+
+  scheduler.Dispatch();
+
+  EXPECT_EQ(VirtualTick::now, 25U);
+  EXPECT_EQ(scheduler.GetStatistics(1).missedReleases, 2U);
+  EXPECT_EQ(scheduler.GetStatistics(1).maxJitter, 25U);
+  EXPECT_EQ(scheduler.GetNextRelease(), 10U);
+}
+
+TEST_F(StaticScheduler, ReturnsEarliestNextReleaseAcrossTheWrapAround)
+{
+  VirtualTick::now = UINT32_MAX - 15;
+  FakeTask<0, 100, 40, 100> first;
+  FakeTask<1, 100, 15, 100> second;
+  auto scheduler = Scheduler::StaticScheduler<VirtualTick, decltype(first), decltype(second)>(first, second);
+
+  EXPECT_EQ(scheduler.GetNextRelease(), UINT32_MAX);
+
+  RunUntil(scheduler, UINT32_MAX);
+  scheduler.Dispatch();
+
+  EXPECT_EQ(scheduler.GetStatistics(1).runs, 1U);
+  EXPECT_EQ(scheduler.GetNextRelease(), 24U);
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <Calendar.hpp>
+#include <cstdint>
+
+using Time::DateTime;
+
+TEST(Calendar, ConvertsKnownDates)
+{
+  static_assert(Time::ToDateTime(0) == DateTime {1970, 1, 1, 0, 0, 0});
+  static_assert(Time::ToDateTime(951782400) == DateTime {2000, 2, 29, 0, 0, 0});
+  static_assert(Time::ToDateTime(1735689599) == DateTime {2024, 12, 31, 23, 59, 59});
+  static_assert(Time::ToDateTime(UINT32_MAX) == DateTime {2106, 2, 7, 6, 28, 15});
+
+  static_assert(Time::ToCounter(DateTime {2000, 2, 29, 0, 0, 0}) == 951782400);
+  static_assert(Time::ToCounter(DateTime {2106, 2, 7, 6, 28, 15}) == UINT32_MAX);
+}
+
+TEST(Calendar, HandlesTheLeapYearRules)
+{
+  // Divisible by 100 but not by 400, 2100 has no leap day
+  const auto endOfFebruary = Time::ToCounter(DateTime {2100, 2, 28, 12, 0, 0});
+  EXPECT_EQ(Time::ToDateTime(endOfFebruary + Time::SecondsPerDay), (DateTime {2100, 3, 1, 12, 0, 0}));
+
+  const auto leapDay = Time::ToCounter(DateTime {2024, 2, 29, 12, 0, 0});
+  EXPECT_EQ(Time::ToDateTime(leapDay + Time::SecondsPerDay), (DateTime {2024, 3, 1, 12, 0, 0}));
+
+  EXPECT_EQ(Time::DaysFromCivil(2001, 1, 1) - Time::DaysFromCivil(2000, 1, 1), 366U);
+  EXPECT_EQ(Time::DaysFromCivil(2101, 1, 1) - Time::DaysFromCivil(2100, 1, 1), 365U);
+}
+
+TEST(Calendar, RoundTripsEveryDay)
+{
+  auto previous = Time::ToDateTime(0);
+
+  for (uint32_t day = 1; day < UINT32_MAX / Time::SecondsPerDay; ++day)
+  {
+    const auto counter = (day * Time::SecondsPerDay) + (day % Time::SecondsPerDay);
+    const auto dateTime = Time::ToDateTime(counter);
+
+    ASSERT_EQ(Time::ToCounter(dateTime), counter) << day;
+
+    // The days follow each other without gaps
+    const auto nextInMonth = dateTime.day == previous.day + 1 && dateTime.month == previous.month;
+    const auto nextMonth = dateTime.day == 1 && (dateTime.month == previous.month + 1 || dateTime.month == 1);
+    ASSERT_TRUE(nextInMonth || nextMonth) << day;
+    previous = dateTime;
+  }
+}
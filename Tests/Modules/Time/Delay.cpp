@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <Delay.hpp>
+#include <chrono>
+#include <cstdint>
+
+using namespace std::chrono_literals;
+
+TEST(Delay, ConvertsDurationsToCyclesOfTheConfiguredClock)
+{
+  static_assert(Time::CyclesPerMillisecond == 72000);
+  static_assert(Time::MicrosecondsToCycles(0) == 0);
+  static_assert(Time::MicrosecondsToCycles(1) == 72);
+  static_assert(Time::MicrosecondsToCycles(5) == 360);
+  static_assert(Time::MicrosecondsToCycles(1000) == Time::CyclesPerMillisecond);
+  static_assert(Time::NanosecondsToCycles(1000) == 72);
+
+  EXPECT_EQ(Time::MicrosecondsToCycles(59'000'000), 4'248'000'000U);
+}
+
+TEST(Delay, RoundsUpToWholeCycles)
+{
+  // One cycle lasts 13.9 ns at 72 MHz
+  static_assert(Time::NanosecondsToCycles(1) == 1);
+  static_assert(Time::NanosecondsToCycles(13) == 1);
+  static_assert(Time::NanosecondsToCycles(14) == 2);
+  static_assert(Time::NanosecondsToCycles(250) == 18);
+
+  for (uint32_t nanoseconds = 1; nanoseconds < 100000; nanoseconds += 7)
+  {
+    const auto cycles = uint64_t {Time::NanosecondsToCycles(nanoseconds)};
+
+    // Never shorter than requested and less than one cycle longer
+    EXPECT_GE(cycles * 1'000'000, uint64_t {nanoseconds} * Time::CyclesPerMillisecond);
+    EXPECT_LT((cycles - 1) * 1'000'000, uint64_t {nanoseconds} * Time::CyclesPerMillisecond);
+  }
+}
+
+TEST(Delay, ConvertsTypedDurationsForOtherClocks)
+{
+  static_assert(Time::ToCycles<8000>(1us) == 8);
+  static_assert(Time::ToCycles<8000>(100ns) == 1);
+  static_assert(Time::ToCycles<8000>(1ms) == 8000);
+  static_assert(Time::ToCycles<36000>(std::chrono::duration<double, std::micro>(0.5)) == 18);
+}
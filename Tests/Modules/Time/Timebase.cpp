@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+
+#include <Timebase.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+  constexpr uint32_t CyclesPerTick = 72000;
+
+  /// @brief Simulated SysTick timer driving a tick counter by its interrupt.
+  /// @details The timer counts down and raises its interrupt when the value changes from one to zero, it reloads with
+  ///          the following cycle. The reads of the timebase advance the simulation by scripted numbers of cycles, so
+  ///          the interrupt can hit any point of the read sequence.
+  struct SimulatedSysTick
+  {
+    static inline Time::TickCounter* counter = nullptr;
+    static inline uint32_t value = 0;
+    static inline bool pending = false;
+    static inline bool masked = false;
+    static inline uint64_t cycles = 0;
+
+    /// @brief Cycle at which the value was read last.
+    static inline uint64_t valueReadAt = 0;
+
+    /// @brief Cycles elapsing before the value is read.
+    static inline uint32_t beforeValue = 0;
+
+    /// @brief Cycles elapsing between reading the value and the pending flag.
+    static inline uint32_t beforePending = 0;
+
+    /// @brief Cycles elapsing after the pending flag is read.
+    static inline uint32_t afterPending = 0;
+
+    static void Reset(Time::TickCounter& tickCounter)
+    {
+      counter = &tickCounter;
+      value = 0;
+      pending = false;
+      masked = false;
+      cycles = 0;
+      valueReadAt = 0;
+      beforeValue = 0;
+      beforePending = 0;
+      afterPending = 0;
+    }
+
+    /// @brief Advances the timer cycle by cycle, running the interrupt handler unless interrupts are masked.
+    static void Advance(uint32_t count)
+    {
+      while (count > 0)
+      {
+        // Cycles without a reload or an interrupt are skipped at once
+        if (value > 1)
+        {
+          const auto step = std::min(count, value - 1);
+          value -= step;
+          cycles += step;
+          count -= step;
+          continue;
+        }
+
+        ++cycles;
+        --count;
+
+        if (value == 0)
+        {
+          value = CyclesPerTick - 1;
+        }
+        else if (--value == 0)
+        {
+          pending = true;
+        }
+
+        if (pending && !masked)
+        {
+          pending = false;
+          counter->Advance(1);
+        }
+      }
+    }
+
+    static uint32_t GetValue()
+    {
+      Advance(beforeValue);
+      valueReadAt = cycles;
+      const auto current = value;
+      Advance(beforePending);
+      return current;
+    }
+
+    static bool IsReloadPending()
+    {
+      const auto current = pending;
+      Advance(afterPending);
+      return current;
+    }
+  };
+
+  /// @brief Cycle source advanced manually by the tests.
+  struct FakeSource
+  {
+    static inline uint64_t now = 0;
+
+    static uint64_t Now()
+    {
+      return now;
+    }
+  };
+
+  /// @brief Reads a timestamp from the simulated timer.
+  uint64_t Read(const Time::TickCounter& counter)
+  {
+    return Time::ReadCycles<CyclesPerTick, SimulatedSysTick>(counter);
+  }
+}  // namespace
+
+TEST(TickCounter, CarriesIntoTheUpperHalf)
+{
+  Time::TickCounter counter;
+
+  counter.Advance(UINT32_MAX - 1);
+  EXPECT_EQ(counter.Get(), UINT32_MAX - 1);
+
+  counter.Advance(3);
+  EXPECT_EQ(counter.GetLow(), 1U);
+  EXPECT_EQ(counter.Get(), (uint64_t {1} << 32U) + 1);
+}
+
+TEST(Timebase, ComposesTicksAndTimerValue)
+{
+  static_assert(Time::ComposeCycles<CyclesPerTick>(0, 0, false) == 0);
+  static_assert(Time::ComposeCycles<CyclesPerTick>(5, CyclesPerTick - 1, false) == (5 * CyclesPerTick) + 1);
+  static_assert(Time::ComposeCycles<CyclesPerTick>(5, 1, false) == (6 * CyclesPerTick) - 1);
+
+  // Interrupt pending, value read after the reload
+  static_assert(Time::ComposeCycles<CyclesPerTick>(5, 0, true) == 6 * CyclesPerTick);
+  static_assert(Time::ComposeCycles<CyclesPerTick>(5, CyclesPerTick - 10, true) == (6 * CyclesPerTick) + 10);
+
+  // Interrupt pending, value read just before the reload
+  static_assert(Time::ComposeCycles<CyclesPerTick>(5, 3, true) == (6 * CyclesPerTick) - 3);
+
+  // Beyond 2^32 ticks
+  EXPECT_EQ(Time::ComposeCycles<CyclesPerTick>(uint64_t {1} << 32U, 0, false), (uint64_t {1} << 32U) * CyclesPerTick);
+}
+
+TEST(Timebase, ReloadBetweenValueAndPendingFlagWithMaskedInterrupts)
+{
+  Time::TickCounter counter;
+  SimulatedSysTick::Reset(counter);
+  SimulatedSysTick::Advance(3 * CyclesPerTick);
+  SimulatedSysTick::masked = true;
+  SimulatedSysTick::Advance(CyclesPerTick - 2);
+
+  // The value 2 is read, the timer reaches zero before the pending flag is read
+  SimulatedSysTick::beforePending = 4;
+  EXPECT_EQ(Read(counter), (4 * CyclesPerTick) - 2);
+
+  // The value is read after the reload, the counter still lags one tick behind
+  SimulatedSysTick::beforePending = 0;
+  EXPECT_EQ(Read(counter), (4 * CyclesPerTick) + 2);
+  EXPECT_EQ(counter.Get(), 3U);
+}
+
+TEST(Timebase, InterruptBetweenCounterAndValueLeadsToRetry)
+{
+  Time::TickCounter counter;
+  SimulatedSysTick::Reset(counter);
+  SimulatedSysTick::Advance((2 * CyclesPerTick) - 1);
+
+  // The counter is read as 1, the interrupt advances it to 2 before the value is read
+  SimulatedSysTick::beforeValue = 2;
+  EXPECT_EQ(Read(counter), (2 * CyclesPerTick) + 3);
+  EXPECT_EQ(counter.Get(), 2U);
+}
+
+TEST(Timebase, TimestampsAreExactAndMonotonicAtEveryInterleaving)
+{
+  std::mt19937 random(3);
+  std::uniform_int_distribution<uint32_t> gaps(0, 3);
+  std::uniform_int_distribution<uint32_t> steps(1, CyclesPerTick / 3);
+
+  for (const auto masked : {false, true})
+  {
+    Time::TickCounter counter;
+    SimulatedSysTick::Reset(counter);
+    uint64_t previous = 0;
+
+    for (auto i = 0; i < 100000; ++i)
+    {
+      // Land close to the tick boundaries most of the time
+      SimulatedSysTick::Advance((i % 4 == 0) ? steps(random) : SimulatedSysTick::value + gaps(random));
+
+      SimulatedSysTick::beforeValue = gaps(random);
+      SimulatedSysTick::beforePending = gaps(random);
+      SimulatedSysTick::afterPending = gaps(random);
+
+      // With masked interrupts, the pending flag is the only hint of the reload, the handler runs after the read
+      SimulatedSysTick::masked = masked;
+      const auto timestamp = Read(counter);
+      SimulatedSysTick::masked = false;
+
+      if (SimulatedSysTick::pending)
+      {
+        SimulatedSysTick::pending = false;
+        counter.Advance(1);
+      }
+
+      ASSERT_EQ(timestamp, SimulatedSysTick::valueReadAt) << "read " << i;
+      ASSERT_GE(timestamp, previous) << "read " << i;
+      previous = timestamp;
+    }
+  }
+}
+
+TEST(Timebase, ConvertsTheTimerValueToAnotherClock)
+{
+  constexpr uint32_t slowCyclesPerTick = 8000;
+
+  static_assert(Time::ConvertTickValue(0, CyclesPerTick, slowCyclesPerTick) == slowCyclesPerTick);
+  static_assert(Time::ConvertTickValue(CyclesPerTick, CyclesPerTick, slowCyclesPerTick) == slowCyclesPerTick);
+  static_assert(Time::ConvertTickValue(1, CyclesPerTick, slowCyclesPerTick) == 1);
+  static_assert(Time::ConvertTickValue(1, slowCyclesPerTick, CyclesPerTick) == 9);
+
+  // The timestamp in cycles of the fast clock continues across the switch in both directions
+  for (uint32_t value = 1; value < CyclesPerTick; value += 7)
+  {
+    const auto before = Time::ComposeCycles<CyclesPerTick>(10, value, false);
+    const auto slowValue = Time::ConvertTickValue(value, CyclesPerTick, slowCyclesPerTick);
+    const auto after = Time::ComposeCycles<slowCyclesPerTick>(10, slowValue, false) * (CyclesPerTick / slowCyclesPerTick);
+
+    ASSERT_LE(std::max(before, after) - std::min(before, after), CyclesPerTick / slowCyclesPerTick) << value;
+    ASSERT_EQ(Time::ConvertTickValue(slowValue, slowCyclesPerTick, CyclesPerTick),
+      slowValue * (CyclesPerTick / slowCyclesPerTick));
+  }
+}
+
+TEST(Timebase, CycleClockProvidesTypedDurations)
+{
+  using ClockType = Time::CycleClock<FakeSource, CyclesPerTick * 1000>;
+  static_assert(std::chrono::is_clock_v<ClockType>);
+
+  const auto start = ClockType::now();
+  FakeSource::now = (uint64_t {1} << 32U) * 72;
+  const auto elapsed = ClockType::now() - start;
+
+  EXPECT_EQ(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), int64_t {1} << 32U);
+  EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::microseconds(1500)).count(), 1);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <Timer.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using RccType = Peripherals::Rcc::ResetAndClockControl;
+using TimerType = Peripherals::Timer::Timer;
+using Peripherals::Timer::Channel;
+
+namespace
+{
+  /// @brief Records the values passed to a timer callback.
+  struct Recorder
+  {
+    std::vector<uint16_t> values;
+
+    static void Record(void* context, const uint16_t value)
+    {
+      static_cast<Recorder*>(context)->values.push_back(value);
+    }
+  };
+}  // namespace
+
+/// @brief Timer driving a simulated register block instead of the peripheral.
+/// @details The simulation does not model the hardware behavior of the registers, the flags written by the driver
+///          are therefore reset before an event is raised.
+class Timer : public ::testing::Test
+{
+ protected:
+  TIM_TypeDef registers {};
+  TimerType& timer = TimerType::GetInstance<Peripherals::Timer::TimerInstance::Tim2>();
+  Recorder recorder;
+
+  void SetUp() override
+  {
+    timer.Configure(&registers, 71);
+  }
+
+  /// @brief Raises the interrupt flags of the given channels and runs the interrupt handler.
+  void Raise(const uint32_t flags)
+  {
+    registers.SR = flags;
+    timer.HandleInterrupt();
+  }
+};
+
+TEST(TimerPrescaler, ReturnsPrescalerForCounterFrequency)
+{
+  static_assert(TimerType::GetPrescaler(72'000'000, 72000) == 0);
+  static_assert(TimerType::GetPrescaler(1'000'000, 72000) == 71);
+  static_assert(TimerType::GetPrescaler(10'000, 72000) == 7199);
+  static_assert(TimerType::GetPrescaler(1'000, 72000) == 0xFFFF);
+  static_assert(TimerType::GetPrescaler(100'000'000, 72000) == 0);
+
+  // Not reachable exactly, the next faster frequency is used
+  static_assert(TimerType::GetPrescaler(7'000'000, 72000) == 9);
+}
+
+TEST_F(Timer, ConfiguresAFreeRunningCounter)
+{
+  EXPECT_EQ(registers.PSC, 71U);
+  EXPECT_EQ(registers.ARR, 0xFFFFU);
+  EXPECT_EQ(registers.EGR, TIM_EGR_UG);
+  EXPECT_EQ(registers.CR1, TIM_CR1_URS | TIM_CR1_CEN);
+  EXPECT_EQ(registers.DIER, 0U);
+  EXPECT_EQ(registers.CCER, 0U);
+}
+
+TEST_F(Timer, OneShotCompareFiresOnce)
+{
+  registers.CNT = 1000;
+  timer.StartOneShot(Channel::Channel3, 250, Recorder::Record, &recorder);
+
+  EXPECT_EQ(registers.CCR3, 1250U);
+  EXPECT_EQ(registers.CCMR2 & TIM_CCMR2_CC3S, 0U);
+  EXPECT_EQ(registers.CCMR2 & TIM_CCMR2_OC3M, 0U);
+  EXPECT_EQ(registers.DIER, TIM_DIER_CC3IE);
+
+  Raise(TIM_SR_CC3IF);
+
+  EXPECT_EQ(recorder.values, (std::vector<uint16_t> {1250}));
+  EXPECT_EQ(registers.DIER, 0U);
+  EXPECT_EQ(registers.SR & TIM_SR_CC3IF, 0U);
+
+  // A stale flag does not invoke the callback again
+  Raise(TIM_SR_CC3IF);
+  EXPECT_EQ(recorder.values.size(), 1U);
+}
+
+TEST_F(Timer, OneShotCompareWrapsAroundTheCounter)
+{
+  registers.CNT = 0xFF00;
+  timer.StartOneShot(Channel::Channel1, 0x200, Recorder::Record, &recorder);
+
+  EXPECT_EQ(registers.CCR1, 0x100U);
+}
+
+TEST_F(Timer, PeriodicCompareAdvancesFromTheLastMatch)
+{
+  registers.CNT = 100;
+  timer.StartPeriodic(Channel::Channel2, 0x6000, Recorder::Record, &recorder);
+
+  for (auto i = 0; i < 3; ++i)
+  {
+    // The counter moved on by the interrupt latency, the next match does not depend on it
+    registers.CNT = registers.CCR2 + 37;
+    Raise(TIM_SR_CC2IF);
+  }
+
+  EXPECT_EQ(recorder.values, (std::vector<uint16_t> {0x6064, 0xC064, 0x2064}));
+  EXPECT_EQ(registers.CCR2, 0x8064U);
+  EXPECT_EQ(registers.DIER, TIM_DIER_CC2IE);
+
+  timer.Stop(Channel::Channel2);
+  EXPECT_EQ(registers.DIER, 0U);
+}
+
+TEST_F(Timer, CaptureConfiguresTheInputAndReportsTheCapturedValue)
+{
+  timer.StartCapture(Channel::Channel4, Peripherals::Timer::Edge::Falling, Recorder::Record, &recorder);
+
+  EXPECT_EQ(registers.CCMR2 & TIM_CCMR2_CC4S, TIM_CCMR2_CC4S_0);
+  EXPECT_EQ(registers.CCER, TIM_CCER_CC4E | TIM_CCER_CC4P);
+  EXPECT_EQ(registers.DIER, TIM_DIER_CC4IE);
+
+  registers.CCR4 = 4242;
+  Raise(TIM_SR_CC4IF);
+  registers.CCR4 = 4343;
+  Raise(TIM_SR_CC4IF);
+
+  EXPECT_EQ(recorder.values, (std::vector<uint16_t> {4242, 4343}));
+  EXPECT_EQ(registers.DIER, TIM_DIER_CC4IE);
+
+  timer.Stop(Channel::Channel4);
+  EXPECT_EQ(registers.CCER, 0U);
+}
+
+TEST_F(Timer, ChannelsAreIndependent)
+{
+  Recorder other;
+  registers.CNT = 0;
+  timer.StartCapture(Channel::Channel1, Peripherals::Timer::Edge::Rising, Recorder::Record, &other);
+  timer.StartOneShot(Channel::Channel2, 10, Recorder::Record, &recorder);
+
+  EXPECT_EQ(registers.CCMR1, TIM_CCMR1_CC1S_0);
+  EXPECT_EQ(registers.CCER, TIM_CCER_CC1E);
+
+  registers.CCR1 = 7;
+  Raise(TIM_SR_CC1IF | TIM_SR_CC2IF | TIM_SR_CC3IF);
+
+  EXPECT_EQ(other.values, (std::vector<uint16_t> {7}));
+  EXPECT_EQ(recorder.values, (std::vector<uint16_t> {10}));
+  EXPECT_EQ(registers.DIER, TIM_DIER_CC1IE);
+}
+
+TEST_F(Timer, KeepsTheCounterFrequencyAcrossClockSwitches)
+{
+  const auto& low = RccType::Profiles[static_cast<std::size_t>(Peripherals::Rcc::ClockProfile::Low)];
+  const auto& high = RccType::Profiles[static_cast<std::size_t>(Peripherals::Rcc::ClockProfile::High)];
+
+  registers.CNT = 1000;
+  timer.StartOneShot(Channel::Channel1, 250, Recorder::Record, &recorder);
+  timer.StartCapture(Channel::Channel2, Peripherals::Timer::Edge::Rising, Recorder::Record, &recorder);
+  registers.CCR2 = 900;
+  registers.EGR = 0;
+
+  // Nothing changes before the switch
+  TimerType::HandleClockChange(&timer, Peripherals::Rcc::ClockChange::Pending, high, low);
+  EXPECT_EQ(registers.PSC, 71U);
+  EXPECT_EQ(registers.EGR, 0U);
+
+  // 1 MHz from 8 MHz, the update event restarts the counter and the pending match keeps its distance
+  TimerType::HandleClockChange(&timer, Peripherals::Rcc::ClockChange::Completed, high, low);
+  EXPECT_EQ(registers.PSC, 7U);
+  EXPECT_EQ(registers.EGR, TIM_EGR_UG);
+  EXPECT_EQ(registers.CCR1, 250U);
+  EXPECT_EQ(registers.CCR2, 900U);
+
+  registers.CNT = 0;
+  TimerType::HandleClockChange(&timer, Peripherals::Rcc::ClockChange::Completed, low, high);
+  EXPECT_EQ(registers.PSC, 71U);
+}
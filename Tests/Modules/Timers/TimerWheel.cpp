@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include <TimerWheel.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using WheelType = Timers::TimerWheel<5, 4>;
+
+  /// @brief Records the ticks at which a timer expired.
+  struct Recorder
+  {
+    WheelType* wheel;
+    std::vector<uint32_t> ticks;
+
+    static void Record(void* context)
+    {
+      auto& recorder = *static_cast<Recorder*>(context);
+      recorder.ticks.push_back(recorder.wheel->GetNow());
+    }
+  };
+
+  /// @brief Advances the wheel tick by tick.
+  void RunUntil(WheelType& wheel, const uint32_t end)
+  {
+    while (wheel.GetNow() != end)
+    {
+      wheel.Advance(wheel.GetNow() + 1);
+    }
+  }
+}  // namespace
+
+TEST(TimerWheel, OneShotTimersExpireAtTheirTickOnEveryLevel)
+{
+  WheelType wheel;
+
+  for (const uint32_t delay : {1U, 2U, 31U, 32U, 33U, 1023U, 1024U, 1025U, 40000U, WheelType::Range + 100U})
+  {
+    Recorder recorder {.wheel = &wheel, .ticks = {}};
+    Timers::Timer timer(Recorder::Record, &recorder);
+    const auto start = wheel.GetNow();
+
+    wheel.Start(timer, delay);
+    RunUntil(wheel, start + delay + 100);
+
+    EXPECT_EQ(recorder.ticks, (std::vector<uint32_t> {start + delay})) << "delay " << delay;
+    EXPECT_FALSE(timer.IsActive());
+  }
+}
+
+TEST(TimerWheel, PeriodicTimerDoesNotDrift)
+{
+  WheelType wheel(7);
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  Timers::Timer timer(Recorder::Record, &recorder);
+
+  wheel.Start(timer, 1000, 1000);
+  RunUntil(wheel, 5007);
+
+  EXPECT_EQ(recorder.ticks, (std::vector<uint32_t> {1007, 2007, 3007, 4007, 5007}));
+  EXPECT_TRUE(timer.IsActive());
+}
+
+TEST(TimerWheel, StoppedTimerDoesNotExpire)
+{
+  WheelType wheel;
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  Timers::Timer first(Recorder::Record, &recorder);
+  Timers::Timer second(Recorder::Record, &recorder);
+
+  wheel.Start(first, 50);
+  wheel.Start(second, 50);
+  wheel.Stop(first);
+  RunUntil(wheel, 100);
+
+  EXPECT_EQ(recorder.ticks, (std::vector<uint32_t> {50}));
+}
+
+TEST(TimerWheel, CallbackCanStopAnotherTimerOfTheSameTick)
+{
+  WheelType wheel;
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  Timers::Timer victim(Recorder::Record, &recorder);
+
+  struct Stopper
+  {
+    WheelType* wheel;
+    Timers::Timer* victim;
+  } stopper {.wheel = &wheel, .victim = &victim};
+
+  Timers::Timer killer([](void* context) {
+    auto& state = *static_cast<Stopper*>(context);
+    state.wheel->Stop(*state.victim);
+  },
+    &stopper);
+
+  // The timer started last is expired first
+  wheel.Start(victim, 10);
+  wheel.Start(killer, 10);
+  RunUntil(wheel, 20);
+
+  EXPECT_TRUE(recorder.ticks.empty());
+}
+
+TEST(TimerWheel, CallbackCanRestartItsTimer)
+{
+  WheelType wheel;
+
+  struct Restarter
+  {
+    WheelType* wheel;
+    Timers::Timer* timer;
+    std::vector<uint32_t> ticks;
+  } restarter {.wheel = &wheel, .timer = nullptr, .ticks = {}};
+
+  Timers::Timer timer([](void* context) {
+    auto& state = *static_cast<Restarter*>(context);
+    state.ticks.push_back(state.wheel->GetNow());
+
+    if (state.ticks.size() < 3)
+    {
+      state.wheel->Start(*state.timer, 1);
+    }
+  },
+    &restarter);
+  restarter.timer = &timer;
+
+  wheel.Start(timer, 32);
+  RunUntil(wheel, 100);
+
+  EXPECT_EQ(restarter.ticks, (std::vector<uint32_t> {32, 33, 34}));
+}
+
+TEST(TimerWheel, DefersThreadCallbacksAndCountsOverruns)
+{
+  WheelType wheel;
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  Timers::Timer timer(Recorder::Record, &recorder, Timers::CallbackContext::Thread);
+
+  wheel.Start(timer, 10, 10);
+  RunUntil(wheel, 35);
+
+  // Nothing ran in the tick, the three expiries are merged into one deferred callback
+  EXPECT_TRUE(recorder.ticks.empty());
+  EXPECT_EQ(timer.GetOverruns(), 2U);
+
+  const auto* deferred = wheel.TakeDeferred();
+  ASSERT_EQ(deferred, &timer);
+  WheelType::RunCallback(*deferred);
+  EXPECT_EQ(wheel.TakeDeferred(), nullptr);
+  EXPECT_EQ(recorder.ticks, (std::vector<uint32_t> {35}));
+}
+
+TEST(TimerWheel, SkippedTicksExpireAllTimers)
+{
+  WheelType wheel;
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  Timers::Timer first(Recorder::Record, &recorder);
+  Timers::Timer second(Recorder::Record, &recorder);
+
+  wheel.Start(first, 40);
+  wheel.Start(second, 200);
+
+  // The tickless idle advances the tick by many at once
+  wheel.Advance(233);
+
+  EXPECT_EQ(recorder.ticks, (std::vector<uint32_t> {40, 200}));
+}
+
+TEST(TimerWheel, HandlesTheWrapAroundOfTheTick)
+{
+  WheelType wheel(UINT32_MAX - 1000);
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  Timers::Timer timer(Recorder::Record, &recorder);
+
+  wheel.Start(timer, 3000, 3000);
+  RunUntil(wheel, 5000);
+
+  EXPECT_EQ(recorder.ticks, (std::vector<uint32_t> {1999, 4999}));
+}
+
+TEST(TimerWheel, NextExpiryNeverPassesATimer)
+{
+  WheelType wheel(123);
+  Recorder recorder {.wheel = &wheel, .ticks = {}};
+  std::vector<std::unique_ptr<Timers::Timer>> timers;
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> delays(1, 50000);
+
+  for (auto i = 0; i < 300; ++i)
+  {
+    timers.push_back(std::make_unique<Timers::Timer>(Recorder::Record, &recorder));
+    wheel.Start(*timers.back(), delays(random));
+  }
+
+  // Jump from bound to bound like the tickless idle, every timer has to expire at its tick
+  std::size_t expired = 0;
+
+  while (recorder.ticks.size() < timers.size())
+  {
+    const auto next = wheel.GetNextExpiry(wheel.GetNow() + 1000000);
+    ASSERT_NE(next, wheel.GetNow());
+    wheel.Advance(next);
+
+    for (; expired < recorder.ticks.size(); ++expired)
+    {
+      EXPECT_EQ(recorder.ticks[expired], next);
+    }
+  }
+
+  EXPECT_EQ(wheel.GetNextExpiry(42), 42U);
+}
+
+TEST(TimerWheel, ManyRandomTimersExpireExactly)
+{
+  WheelType wheel;
+  std::vector<std::unique_ptr<Recorder>> recorders;
+  std::vector<std::unique_ptr<Timers::Timer>> timers;
+  std::vector<uint32_t> expected;
+  std::mt19937 random(7);
+  std::uniform_int_distribution<uint32_t> delays(1, 70000);
+
+  for (auto i = 0; i < 500; ++i)
+  {
+    recorders.push_back(std::make_unique<Recorder>(Recorder {.wheel = &wheel, .ticks = {}}));
+    timers.push_back(std::make_unique<Timers::Timer>(Recorder::Record, recorders.back().get()));
+    expected.push_back(delays(random));
+    wheel.Start(*timers.back(), expected.back());
+  }
+
+  RunUntil(wheel, 70001);
+
+  for (std::size_t i = 0; i < timers.size(); ++i)
+  {
+    EXPECT_EQ(recorders[i]->ticks, (std::vector<uint32_t> {expected[i]}));
+  }
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include <Rcc.hpp>
+#include <Usart.hpp>
+#include <cstddef>
+#include <cstdint>
+
+using UsartType = Peripherals::Usart::UniversalSynchronousAsynchronousReceiverTransmitter;
+
+TEST(UsartClockChange, ScalesTheBaudRateDividerToTheBusClock)
+{
+  const auto& low = RccType::Profiles[static_cast<std::size_t>(Peripherals::Rcc::ClockProfile::Low)];
+  const auto& high = RccType::Profiles[static_cast<std::size_t>(Peripherals::Rcc::ClockProfile::High)];
+
+  // Any register block other than USART1 is clocked by APB1
+  USART_TypeDef registers {};
+  registers.SR = USART_SR_TC;
+  auto& usart = UsartType::GetInstance<Peripherals::Usart::UsartInstance::Usart2>();
+  usart.Configure(&registers, UsartType::GetMantissaAndFraction(115200, high.apb1Clock / 1000));
+  ASSERT_EQ(registers.BRR, (19U << USART_BRR_DIV_Mantissa_Pos) | 9U);
+
+  // The transmitter is idle, so the pending switch does not wait
+  UsartType::HandleClockChange(&usart, Peripherals::Rcc::ClockChange::Pending, high, low);
+  EXPECT_EQ(registers.BRR, (19U << USART_BRR_DIV_Mantissa_Pos) | 9U);
+
+  // 36 MHz to 8 MHz, 70 sixteenths of 8 MHz are 114286 baud
+  UsartType::HandleClockChange(&usart, Peripherals::Rcc::ClockChange::Completed, high, low);
+  EXPECT_EQ(registers.BRR, 70U);
+
+  // Switching back restores the divider without accumulated rounding errors
+  for (auto i = 0; i < 3; ++i)
+  {
+    UsartType::HandleClockChange(&usart, Peripherals::Rcc::ClockChange::Completed, low, high);
+    EXPECT_EQ(registers.BRR, (19U << USART_BRR_DIV_Mantissa_Pos) | 9U);
+    UsartType::HandleClockChange(&usart, Peripherals::Rcc::ClockChange::Completed, high, low);
+    EXPECT_EQ(registers.BRR, 70U);
+  }
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <VectorTable.hpp>
+#include <bit>
+#include <cstdint>
+
+using Peripherals::Vectors::IndexOf;
+using Peripherals::Vectors::RamVectorTable;
+using Peripherals::Vectors::VectorTable;
+
+namespace
+{
+  void TickHandler()
+  {
+  }
+
+  void ButtonHandler()
+  {
+  }
+
+  void OtherButtonHandler()
+  {
+  }
+
+  void TrapHandler()
+  {
+  }
+
+  constexpr auto Table = VectorTable {
+    {IRQn_Type::SysTick_IRQn, TickHandler},
+    {IRQn_Type::EXTI0_IRQn, ButtonHandler},
+    {IRQn_Type::USBWakeUp_IRQn, ButtonHandler},
+  };
+
+  // The positions of the startup file, the reserved words behind the last interrupt are not part of the table
+  static_assert(IndexOf(IRQn_Type::NonMaskableInt_IRQn) == 2);
+  static_assert(IndexOf(IRQn_Type::SysTick_IRQn) == 15);
+  static_assert(IndexOf(IRQn_Type::EXTI0_IRQn) == 22);
+  static_assert(IndexOf(IRQn_Type::USBWakeUp_IRQn) == Peripherals::Vectors::VectorCount - 1);
+  static_assert(Peripherals::Vectors::VectorCount == 59);
+  static_assert(std::has_single_bit(Peripherals::Vectors::TableAlignment));
+  static_assert(Peripherals::Vectors::TableAlignment >= Peripherals::Vectors::VectorCount * sizeof(void (*)()));
+
+  static_assert(Table.IsUsed(IRQn_Type::EXTI0_IRQn) && !Table.IsUsed(IRQn_Type::EXTI1_IRQn));
+  static_assert(Table.GetUsedInterrupts() == 2);
+}  // namespace
+
+TEST(VectorTable, LoadsTheVectorsAndTrapsTheUnusedOnes)
+{
+  RamVectorTable ram;
+  ram.Load(Table, TrapHandler);
+
+  EXPECT_EQ(ram.Get(IRQn_Type::SysTick_IRQn), TickHandler);
+  EXPECT_EQ(ram.Get(IRQn_Type::EXTI0_IRQn), ButtonHandler);
+  EXPECT_EQ(ram.Get(IRQn_Type::EXTI1_IRQn), TrapHandler);
+  EXPECT_EQ(ram.Get(IRQn_Type::HardFault_IRQn), TrapHandler);
+}
+
+TEST(VectorTable, IsAlignedForTheVectorTableOffsetRegister)
+{
+  RamVectorTable ram;
+
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(&ram) % Peripherals::Vectors::TableAlignment, 0U);
+}
+
+TEST(VectorTable, SwapsAHandlerAtRuntime)
+{
+  RamVectorTable ram;
+  ram.Load(Table, TrapHandler);
+
+  ram.Set(IRQn_Type::EXTI0_IRQn, OtherButtonHandler);
+
+  EXPECT_EQ(ram.Get(IRQn_Type::EXTI0_IRQn), OtherButtonHandler);
+  EXPECT_EQ(ram.Get(IRQn_Type::USBWakeUp_IRQn), ButtonHandler);
+}
@@ -0,0 +1,44 @@
+# Checks the size of an interrupt handler in the linked firmware and that no peripheral singleton needs a guard.
+#
+# Usage: cmake -DNM=<nm> -DELF=<firmware> -DSYMBOL=<handler> -DMAX_SIZE=<bytes> -P check-isr-size.cmake
+#
+# A MAX_SIZE of 0 prints the size of the handler without checking it.
+#
+# The handlers run on every tick, a growing handler is a performance regression. The guard variables of function
+# local statics are checked on every call and are racy with -fno-threadsafe-statics, so the peripheral singletons
+# are constant initialized instead.
+
+execute_process(
+  COMMAND ${NM} --print-size --radix=d ${ELF}
+  OUTPUT_VARIABLE symbols
+  RESULT_VARIABLE result)
+
+if (NOT result EQUAL 0)
+  message(FATAL_ERROR "Reading the symbols of ${ELF} failed")
+endif()
+
+string(REGEX MATCH "[0-9]+ 0*([0-9]+) [Tt] ${SYMBOL}\n" match "${symbols}")
+
+if (match STREQUAL "")
+  message(FATAL_ERROR "${SYMBOL} not found in ${ELF}")
+endif()
+
+set(size ${CMAKE_MATCH_1})
+
+# A limit of 0 only reports the size, e.g. while the handler is reworked
+if (MAX_SIZE EQUAL 0)
+  message(STATUS "${SYMBOL}: ${size} bytes, no limit set")
+else()
+  message(STATUS "${SYMBOL}: ${size} of ${MAX_SIZE} bytes")
+
+  if (size GREATER MAX_SIZE)
+    message(FATAL_ERROR "${SYMBOL} grew to ${size} bytes, the limit is ${MAX_SIZE} bytes")
+  endif()
+endif()
+
+# Guard variables of function local statics in the Peripherals namespace are mangled as _ZGVZN11Peripherals
+string(REGEX MATCH "_ZGVZN11Peripherals[^\n]*" guard "${symbols}")
+
+if (NOT guard STREQUAL "")
+  message(FATAL_ERROR "Peripheral singleton with guard variable ${guard}")
+endif()